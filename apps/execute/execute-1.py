@@ -35,6 +35,7 @@
 #
 ##########################################################################
 
+import contextlib
 import sys
 import pathlib
 import traceback
@@ -111,6 +112,17 @@ class execute( Gaffer.Application ) :
 					},
 				),
 
+				IECore.FileNameParameter(
+					name = "traceFile",
+					description = "Writes a trace of all hash and compute processes to the specified "
+						"file, in the Chrome trace event format. This can be loaded into `chrome://tracing` "
+						"or https://ui.perfetto.dev to view a timeline of the execution. The trace is "
+						"written incrementally, so may also be inspected while execution is in progress.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json",
+				),
+
 			]
 
 		)
@@ -169,7 +181,11 @@ class execute( Gaffer.Application ) :
 		# accidentally using the default frame set in the script
 		del context["frame"]
 
-		with context :
+		traceMonitor = None
+		if args["traceFile"].value :
+			traceMonitor = Gaffer.TraceMonitor( args["traceFile"].value )
+
+		with context, traceMonitor or contextlib.nullcontext() :
 			for node in nodes :
 				node.errorSignal().connect( Gaffer.WeakMethod( self.__error ) )
 				try :
@@ -267,6 +267,15 @@ class stats( Gaffer.Application ) :
 					defaultValue = 0,
 				),
 
+				IECore.BoolParameter(
+					name = "cacheStatistics",
+					description = "Outputs statistics for the ValuePlug compute and hash "
+						"caches, including a breakdown of compute cache memory usage by "
+						"node type and plug. Tracking the memory usage adds a small overhead "
+						"to all cache operations.",
+					defaultValue = False,
+				),
+
 			]
 
 		)
@@ -324,6 +333,10 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__contextMonitor = None
 
+		if args["cacheStatistics"].value :
+			Gaffer.ValuePlug.setCacheUsageTrackingEnabled( True )
+			Gaffer.ValuePlug.resetCacheStatistics()
+
 		if args["vtune"].value :
 			try:
 				self.__vtuneMonitor = Gaffer.VTuneMonitor()
@@ -376,6 +389,11 @@ class stats( Gaffer.Application ) :
 
 		self.__output.write( "\n" )
 
+		if args["cacheStatistics"].value :
+
+			self.__writeCacheStatistics( args )
+			self.__output.write( "\n" )
+
 		self.__writePerformance( script, args )
 
 		self.__output.write( "\n" )
@@ -681,6 +699,36 @@ class stats( Gaffer.Application ) :
 		self.__output.write( "Memory :\n\n" )
 		self.__writeItems( items )
 
+	def __writeCacheStatistics( self, args ) :
+
+		def statisticsItems( statistics ) :
+
+			lookups = statistics.hits + statistics.misses
+			return [
+				( "Hits", statistics.hits ),
+				( "Misses", statistics.misses ),
+				( "Hit rate", "{:.1f}%".format( 100.0 * statistics.hits / lookups ) if lookups else "n/a" ),
+				( "Collaborations", statistics.collaborations ),
+				( "Evictions", statistics.evictions ),
+			]
+
+		self.__output.write( "Compute cache :\n\n" )
+		self.__writeItems( statisticsItems( Gaffer.ValuePlug.computeCacheStatistics() ) )
+
+		self.__output.write( "\nHash cache :\n\n" )
+		self.__writeItems( statisticsItems( Gaffer.ValuePlug.hashCacheStatistics() ) )
+
+		usage = sorted(
+			Gaffer.ValuePlug.cacheMemoryUsageByNodeType().items(),
+			key = lambda x : x[1].bytes, reverse = True
+		)
+
+		self.__output.write( "\nCompute cache usage :\n\n" )
+		self.__writeItems( [
+			( "{} : {}".format( *key ), "{} ({} entries)".format( _Memory( value.bytes ), value.entries ) )
+			for key, value in usage[:args["maxLinesPerMetric"].value]
+		] )
+
 	def __writeStatisticsItems( self, script, stats, key, n ) :
 
 		stats.sort( key = key, reverse = True )
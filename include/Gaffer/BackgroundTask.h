@@ -65,6 +65,10 @@ class Plug;
 /// automatically cancels all affected background operations before an
 /// edit is performed, leaving the UI to restart the background tasks
 /// once the edit has been completed.
+///
+/// BackgroundTasks may also be given a priority, so that tasks which
+/// provide interactive feedback are not held up by long-running tasks
+/// whose results are less urgent.
 class GAFFER_API BackgroundTask : public boost::noncopyable
 {
 
@@ -72,6 +76,20 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 
 		using Function = std::function<void ( const IECore::Canceller & )>;
 
+		enum class Priority
+		{
+			/// For long-running tasks whose results are not urgently required.
+			/// Low priority tasks are given threads only when they are not
+			/// wanted by tasks of higher priority.
+			Low,
+			/// The default priority, suitable for most tasks.
+			Normal,
+			/// For tasks which provide interactive feedback, such as updates
+			/// for the Viewer. High priority tasks are given threads in preference
+			/// to tasks of lower priority.
+			High
+		};
+
 		/// Launches a background task to run `function`, which is expected
 		/// to perform asynchronous computes using the `subject` plug.
 		/// The `function` is passed an `IECore::Canceller` object which must
@@ -79,7 +97,7 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 		///
 		/// > Note : Gaffer's responsiveness to asynchronous edits is entirely
 		/// > dependent on prompt responses to cancellation requests.
-		BackgroundTask( const Plug *subject, const Function &function );
+		BackgroundTask( const Plug *subject, const Function &function, Priority priority = Priority::Normal );
 		/// Calls `cancelAndWait()`. This allows the lifetime of the
 		/// BackgroundTask to be used to protect access to resources
 		//  required by the background function.
@@ -119,6 +137,8 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 		/// >   for cancellation.
 		Status status() const;
 
+		Priority priority() const;
+
 	private :
 
 		// Called by `Action` to ensure that any related tasks are cancelled
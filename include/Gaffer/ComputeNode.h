@@ -41,6 +41,8 @@
 
 #include "IECore/MurmurHash.h"
 
+#include <atomic>
+
 namespace Gaffer
 {
 
@@ -62,6 +64,24 @@ class GAFFER_API ComputeNode : public DependencyNode
 
 		GAFFER_NODE_DECLARE_TYPE( Gaffer::ComputeNode, ComputeNodeTypeId, DependencyNode );
 
+		/// Controls whether or not outputs are evaluated directly, bypassing the
+		/// hash and compute caches. See `ValuePlug::setAutomaticDirectEvaluationEnabled()`.
+		enum class DirectEvaluation
+		{
+			/// Outputs are evaluated directly if profiling determines that they
+			/// are cheap to compute, and automatic direct evaluation is enabled.
+			Automatic,
+			/// Outputs are always cached according to `computeCachePolicy()`.
+			Never,
+			/// Outputs are always evaluated directly, without caching. Note that
+			/// hashes are still cached according to `hashCachePolicy()`, so
+			/// that they are available to downstream nodes.
+			Always
+		};
+
+		void setDirectEvaluation( DirectEvaluation directEvaluation );
+		DirectEvaluation getDirectEvaluation() const;
+
 	protected :
 
 		/// Called to compute the hashes for output Plugs. Must be implemented to call the base
@@ -88,6 +108,8 @@ class GAFFER_API ComputeNode : public DependencyNode
 
 		friend class ValuePlug;
 
+		std::atomic<DirectEvaluation> m_directEvaluation;
+
 };
 
 } // namespace Gaffer
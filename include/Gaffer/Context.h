@@ -250,6 +250,13 @@ class GAFFER_API Context : public IECore::RefCounted
 
 			private :
 
+				// EditableScopes are frequently created in tight loops, so we
+				// recycle their contexts via a small per-thread pool. This reuses
+				// the storage already allocated for the variables, avoiding
+				// allocation in the common case.
+				static Ptr acquireContext( const Context *context );
+				void releaseContext();
+
 				Ptr m_context;
 				// Provides storage for `setFrame()` and `setTime()` to use
 				// (There is no easy way to provide external storage for
@@ -352,6 +359,9 @@ class GAFFER_API Context : public IECore::RefCounted
 		// manage ownership in any way. If ownership is required, call
 		// `internalSetWithOwner()` instead.
 		void internalSet( const IECore::InternedString &name, const Value &value );
+		// Updates `m_hash` to account for a variable changing from `oldValueHash`
+		// to `newValueHash`.
+		void updateHash( const IECore::MurmurHash &oldValueHash, const IECore::MurmurHash &newValueHash );
 		// Sets a variable and maintains ownership of its data via `owner`.
 		void internalSetWithOwner( const IECore::InternedString &name, const Value &value, IECore::ConstDataPtr &&owner );
 		// Throws if variable doesn't exist.
@@ -189,8 +189,9 @@ inline void Context::internalSet( const IECore::InternedString &name, const Valu
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
-		m_hashValid = false;
+		Value &v = m_map[name];
+		updateHash( v.hash(), value.hash() );
+		v = value;
 	}
 	else
 	{
@@ -198,18 +199,33 @@ inline void Context::internalSet( const IECore::InternedString &name, const Valu
 		// `m_allocMap` already (removing the previous value).
 		Value &v = m_map[name];
 		const bool changed = v != value;
+		updateHash( v.hash(), value.hash() );
 		v = value;
 		if( changed )
 		{
 			// But avoid emitting `changedSignal` if the value hasn't
 			// actually changed. We want to avoid expensive re-evaluations
 			// that might otherwise be triggered in the UI.
-			m_hashValid = false;
 			(*m_changedSignal)( this, name );
 		}
 	}
 }
 
+inline void Context::updateHash( const IECore::MurmurHash &oldValueHash, const IECore::MurmurHash &newValueHash )
+{
+	// The context hash is just the sum of the variable hashes, so if it is
+	// already valid, we can update it in place rather than pay for a full
+	// rehash later. A default-constructed `Value` has a zero hash, so this
+	// also works when adding and removing variables.
+	if( m_hashValid )
+	{
+		m_hash = IECore::MurmurHash(
+			m_hash.h1() - oldValueHash.h1() + newValueHash.h1(),
+			m_hash.h2() - oldValueHash.h2() + newValueHash.h2()
+		);
+	}
+}
+
 inline void Context::internalSetWithOwner( const IECore::InternedString &name, const Value &value, IECore::ConstDataPtr &&owner )
 {
 	IECore::ConstDataPtr &currentOwner = m_allocMap[name];
@@ -36,6 +36,7 @@
 
 #pragma once
 
+#include "Gaffer/BackgroundTask.h"
 #include "Gaffer/Export.h"
 #include "Gaffer/Signals.h"
 
@@ -45,7 +46,6 @@
 namespace Gaffer
 {
 
-class BackgroundTask;
 class Plug;
 
 namespace ParallelAlgo
@@ -82,7 +82,7 @@ GAFFER_API bool canCallOnUIThread();
 /// explicitly. Implicit cancellation is also performed using the `subject`
 /// argument : see the `BackgroundTask` documentation for details.
 using BackgroundFunction = std::function<void ()>;
-GAFFER_API std::unique_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, BackgroundFunction function );
+GAFFER_API std::unique_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, BackgroundFunction function, BackgroundTask::Priority priority = BackgroundTask::Priority::Normal );
 
 } // namespace ParallelAlgo
 
@@ -39,6 +39,7 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <cstdint>
 #include <optional>
 
 namespace IECorePreview
@@ -99,6 +100,11 @@ class LRUCache : private boost::noncopyable
 
 		using Cost = size_t;
 		using KeyType = Key;
+		/// Retention makes an item more resistant to eviction. Each unit of
+		/// retention allows an item to survive one additional eviction pass
+		/// after it has ceased to be recently used. The full retention is
+		/// restored each time the item is used again.
+		using Retention = uint8_t;
 
 		/// The GetterFunction is responsible for computing the value and cost for a cache entry
 		/// when given the key. It should throw a descriptive exception if it can't get the data for
@@ -137,6 +143,17 @@ class LRUCache : private boost::noncopyable
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
 		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		/// As above, but additionally calling `retentionFunction( cost )` to
+		/// determine the retention for the item. This allows items which are
+		/// expensive to recompute to be kept in preference to cheaper ones.
+		template<typename CostFunction, typename RetentionFunction>
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, RetentionFunction &&retentionFunction );
+		/// As above, but additionally calling `insertionFunction( cost )` if
+		/// the item is stored. This is called before the item can be evicted,
+		/// so may be used in conjunction with the RemovalCallback to track the
+		/// contents of the cache.
+		template<typename CostFunction, typename RetentionFunction, typename InsertionFunction>
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, RetentionFunction &&retentionFunction, InsertionFunction &&insertionFunction );
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
@@ -197,6 +214,8 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			Retention retention; // eviction passes to survive after each use
+			Retention remainingRetention; // eviction passes to survive before next use
 
 			Status status() const;
 
@@ -214,7 +233,7 @@ class LRUCache : private boost::noncopyable
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, Retention retention = 0 );
 
 		// Removes any cached value and updates the current total
 		// cost.
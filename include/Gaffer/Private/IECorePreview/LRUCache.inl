@@ -238,11 +238,12 @@ class Serial
 		}
 
 		// Marks the CacheEntry referred to by the handle as recently
-		// used.
+		// used, restoring its full retention.
 		void push( Handle &handle )
 		{
 			List &list = m_mapAndList.template get<1>();
 			list.relocate( list.end(), list.iterator_to( *(handle.m_it) ) );
+			handle.m_it->cacheEntry.remainingRetention = handle.m_it->cacheEntry.retention;
 		}
 
 		// Pops a copy of the least recently used CacheEntry from the policy,
@@ -257,11 +258,30 @@ class Serial
 			// access, there may still be existing handles if the
 			// GetterFunction has reentered the cache with a call
 			// to `get( someOtherKey )`, and this inner call has
-			// then entered `limitCost()`.
+			// then entered `limitCost()`. Items with retention
+			// remaining are given another chance by moving them
+			// to the back of the list.
 			typename List::iterator it = list.begin();
-			while( it != list.end() && it->handleCount )
+			while( it != list.end() )
 			{
-				++it;
+				if( it->handleCount )
+				{
+					++it;
+				}
+				else if( it->cacheEntry.remainingRetention )
+				{
+					it->cacheEntry.remainingRetention--;
+					typename List::iterator next = std::next( it );
+					if( next != list.end() )
+					{
+						list.relocate( list.end(), it );
+						it = next;
+					}
+				}
+				else
+				{
+					break;
+				}
 			}
 
 			if( it == list.end() )
@@ -563,7 +583,8 @@ class Parallel
 
 				if( itemLock.try_acquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const bool recentlyUsed = m_popIterator->recentlyUsed.load( std::memory_order_acquire );
+					if( !recentlyUsed && !m_popIterator->cacheEntry.remainingRetention )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -579,12 +600,22 @@ class Parallel
 						m_popIterator = bin->map.erase( m_popIterator );
 						return true;
 					}
-					else
+					else if( recentlyUsed )
 					{
 						// Item has been used recently. Flag it so we
 						// can pop it next time round, unless another
-						// thread resets the flag.
+						// thread resets the flag. We restore the full
+						// retention here rather than in `push()`, because
+						// we hold the item lock.
 						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						m_popIterator->cacheEntry.remainingRetention = m_popIterator->cacheEntry.retention;
+						itemLock.release();
+					}
+					else
+					{
+						// Item hasn't been used recently, but has retention
+						// remaining. Use up one unit and move on.
+						m_popIterator->cacheEntry.remainingRetention--;
 						itemLock.release();
 					}
 				}
@@ -948,7 +979,8 @@ class TaskParallel
 
 				if( itemLock.tryAcquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const bool recentlyUsed = m_popIterator->recentlyUsed.load( std::memory_order_acquire );
+					if( !recentlyUsed && !m_popIterator->cacheEntry.remainingRetention )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -964,12 +996,22 @@ class TaskParallel
 						m_popIterator = bin->map.erase( m_popIterator );
 						return true;
 					}
-					else
+					else if( recentlyUsed )
 					{
 						// Item has been used recently. Flag it so we
 						// can pop it next time round, unless another
-						// thread resets the flag.
+						// thread resets the flag. We restore the full
+						// retention here rather than in `push()`, because
+						// we hold the item lock.
 						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						m_popIterator->cacheEntry.remainingRetention = m_popIterator->cacheEntry.retention;
+						itemLock.release();
+					}
+					else
+					{
+						// Item hasn't been used recently, but has retention
+						// remaining. Use up one unit and move on.
+						m_popIterator->cacheEntry.remainingRetention--;
 						itemLock.release();
 					}
 				}
@@ -1012,7 +1054,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), retention( 0 ), remainingRetention( 0 )
 {
 }
 
@@ -1169,6 +1211,26 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
 bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+{
+	return setIfUncached(
+		key, value, std::forward<CostFunction>( costFunction ),
+		[] ( Cost cost ) { return Retention( 0 ); }
+	);
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+template<typename CostFunction, typename RetentionFunction>
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, RetentionFunction &&retentionFunction )
+{
+	return setIfUncached(
+		key, value, std::forward<CostFunction>( costFunction ), std::forward<RetentionFunction>( retentionFunction ),
+		[] ( Cost cost ) {}
+	);
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+template<typename CostFunction, typename RetentionFunction, typename InsertionFunction>
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, RetentionFunction &&retentionFunction, InsertionFunction &&insertionFunction )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1241,14 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		const Cost cost = costFunction( value );
+		result = setInternal( key, handle.writable(), value, cost, retentionFunction( cost ) );
+		if( result )
+		{
+			// Called while we still hold the handle, so that the item
+			// can't be evicted (and the RemovalCallback called) first.
+			insertionFunction( cost );
+		}
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1258,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, Retention retention )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,6 +1269,8 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.retention = retention;
+	cacheEntry.remainingRetention = retention;
 
 	m_policy.currentCost += cost;
 
@@ -1247,6 +1318,8 @@ bool LRUCache<Key, Value, Policy, GetterKey>::eraseInternal( const Key &key, Cac
 	}
 
 	cacheEntry.state = boost::blank();
+	cacheEntry.retention = 0;
+	cacheEntry.remainingRetention = 0;
 	return status == Cached;
 }
 
@@ -115,12 +115,22 @@ class GAFFER_API Process : private ThreadState::Scope
 		///   to be used for the caching of the result.
 		/// - `ProcessType::cacheCostFunction()` is a static function suitable
 		///   for use with `CacheType::setIfUncached()`.
+		/// - `ProcessType::cacheRetention( cost )` is optional. If defined, it is
+		///   called when the result is stored in the cache, and returns the
+		///   retention to be used. Otherwise the result is stored without retention.
+		/// - `ProcessType::cacheInserted( cost )` is optional. If defined, it is
+		///   called after the result has been stored in the cache.
 		///
 		template<typename ProcessType, typename... ProcessArguments>
 		static typename ProcessType::ResultType acquireCollaborativeResult(
 			const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
 		);
 
+		/// Returns the number of times that `acquireCollaborativeResult<ProcessType>()`
+		/// has waited for a result being computed by another thread.
+		template<typename ProcessType>
+		static size_t collaborationCount();
+
 	private :
 
 		class Collaboration;
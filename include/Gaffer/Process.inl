@@ -39,7 +39,10 @@
 #include "tbb/task_arena.h"
 #include "tbb/task_group.h"
 
+#include <atomic>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 
 namespace Gaffer
@@ -300,11 +303,46 @@ class Process::TypedCollaboration : public Process::Collaboration
 		using PendingCollaborations = tbb::concurrent_hash_map<typename ProcessType::CacheType::KeyType, std::vector<Ptr>>;
 		static PendingCollaborations g_pendingCollaborations;
 
+		static std::atomic_size_t g_collaborationCount;
+
 };
 
 template<typename ProcessType>
 typename Process::TypedCollaboration<ProcessType>::PendingCollaborations Process::TypedCollaboration<ProcessType>::g_pendingCollaborations;
 
+template<typename ProcessType>
+std::atomic_size_t Process::TypedCollaboration<ProcessType>::g_collaborationCount( 0 );
+
+namespace Detail
+{
+
+template<typename ProcessType, typename = void>
+struct HasCacheRetention : std::false_type {};
+
+template<typename ProcessType>
+struct HasCacheRetention<ProcessType, std::void_t<decltype( std::declval<const ProcessType &>().cacheRetention( size_t( 0 ) ) )>> : std::true_type {};
+
+template<typename ProcessType, typename = void>
+struct HasCacheInserted : std::false_type {};
+
+template<typename ProcessType>
+struct HasCacheInserted<ProcessType, std::void_t<decltype( std::declval<const ProcessType &>().cacheInserted( size_t( 0 ) ) )>> : std::true_type {};
+
+template<typename ProcessType>
+typename ProcessType::CacheType::Retention cacheRetention( const ProcessType &process, size_t cost )
+{
+	if constexpr( HasCacheRetention<ProcessType>::value )
+	{
+		return process.cacheRetention( cost );
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+} // namespace Detail
+
 template<typename ProcessType, typename... ProcessArguments>
 typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
@@ -384,6 +422,10 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 
 		accessor.release();
 
+		// Collaboration is relatively rare, and always preceded by an expensive
+		// search, so contention on this counter is not a concern.
+		CollaborationType::g_collaborationCount.fetch_add( 1, std::memory_order_relaxed );
+
 		collaboration->arena.execute(
 			[&]{ return collaboration->taskGroup.wait(); }
 		);
@@ -426,10 +468,26 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 						// Publish result to cache before we remove ourself from
 						// `g_pendingCollaborations`, so that other threads will
 						// be able to get the result one way or the other.
-						ProcessType::g_cache.setIfUncached(
-							cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
-							ProcessType::cacheCostFunction
-						);
+						const auto &result = std::get<typename ProcessType::ResultType>( collaboration->result );
+						if constexpr( Detail::HasCacheInserted<ProcessType>::value )
+						{
+							ProcessType::g_cache.setIfUncached(
+								cacheKey, result, ProcessType::cacheCostFunction,
+								[&process] ( size_t cost ) { return Detail::cacheRetention( process, cost ); },
+								[&process] ( size_t cost ) { process.cacheInserted( cost ); }
+							);
+						}
+						else if constexpr( Detail::HasCacheRetention<ProcessType>::value )
+						{
+							ProcessType::g_cache.setIfUncached(
+								cacheKey, result, ProcessType::cacheCostFunction,
+								[&process] ( size_t cost ) { return process.cacheRetention( cost ); }
+							);
+						}
+						else
+						{
+							ProcessType::g_cache.setIfUncached( cacheKey, result, ProcessType::cacheCostFunction );
+						}
 					}
 					catch( ... )
 					{
@@ -459,6 +517,12 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	return collaboration->resultOrException();
 }
 
+template<typename ProcessType>
+size_t Process::collaborationCount()
+{
+	return TypedCollaboration<ProcessType>::g_collaborationCount.load( std::memory_order_relaxed );
+}
+
 inline bool Process::forceMonitoring( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType )
 {
 	if( s.m_mightForceMonitoring )
@@ -61,6 +61,9 @@ struct SetProvider
 	virtual ~SetProvider() {};
 };
 
+/// Parsed expressions are cached, so repeated evaluation of the same expression
+/// is cheap. Operands which occur more than once are evaluated only once, and
+/// independent operands are evaluated in parallel.
 GAFFER_API IECore::PathMatcher evaluateSetExpression( const std::string &setExpression, const SetProvider &setProvider );
 
 GAFFER_API void setExpressionHash( const std::string &setExpression, const SetProvider &setProvider, IECore::MurmurHash &h );
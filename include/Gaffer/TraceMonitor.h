@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "IECore/MurmurHash.h"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which streams the start and end of each process to a file in the
+/// Chrome trace event format, so that it can be viewed as a timeline in
+/// `chrome://tracing` or https://ui.perfetto.dev. Events are recorded into a
+/// lock-free ring buffer per thread, and are written to file periodically by a
+/// background thread. This allows the trace for a long-running process to be
+/// inspected before it has completed.
+class GAFFER_API TraceMonitor : public Monitor
+{
+
+	public :
+
+		/// Events for processes with types not in `processMask` are ignored.
+		/// Throws if `fileName` cannot be opened for writing.
+		TraceMonitor(
+			const std::string &fileName,
+			const std::vector<IECore::InternedString> &processMask = { "computeNode:hash", "computeNode:compute" },
+			size_t bufferSize = 65536
+		);
+		/// Writes any outstanding events and completes the file.
+		~TraceMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( TraceMonitor )
+
+		const std::string &fileName() const;
+
+		/// Writes all events recorded so far to the file. Note that the file
+		/// is only completed by the destructor, but trace viewers are
+		/// typically able to load incomplete files.
+		void flush();
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+
+	private :
+
+		struct Event
+		{
+			// Time since the monitor was constructed.
+			std::chrono::nanoseconds time;
+			// Null for end events.
+			const std::string *plugName;
+			IECore::InternedString processType;
+			IECore::MurmurHash contextHash;
+		};
+
+		// Single-producer, single-consumer ring buffer, written to by
+		// a single thread and read from by the writer.
+		struct ThreadBuffer
+		{
+			ThreadBuffer( size_t size, int id );
+			const int id;
+			std::vector<Event> events;
+			std::atomic_size_t head;
+			std::atomic_size_t tail;
+			// Plug names are computed once per plug per thread, and are
+			// referenced by pointer from events. The map holds a reference
+			// to each plug so that addresses can't be reused for new plugs
+			// while we are running.
+			std::unordered_map<ConstPlugPtr, std::string> plugNames;
+			// Only accessed by the writer.
+			bool described;
+		};
+
+		void pushEvent( const Process *process, bool begin );
+		ThreadBuffer &threadBuffer();
+
+		void writerLoop();
+		// Must be called with `m_writerMutex` locked.
+		void writeEvents();
+
+		const std::string m_fileName;
+		const std::vector<IECore::InternedString> m_processMask;
+		const size_t m_bufferSize;
+		const std::chrono::steady_clock::time_point m_startTime;
+
+		tbb::enumerable_thread_specific<ThreadBuffer *> m_threadBuffers;
+		std::mutex m_threadBuffersMutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> m_allThreadBuffers;
+
+		std::mutex m_writerMutex;
+		std::condition_variable m_writerCondition;
+		bool m_stopping;
+		std::ofstream m_file;
+		bool m_firstEvent;
+		std::thread m_writerThread;
+
+};
+
+IE_CORE_DECLAREPTR( TraceMonitor )
+
+} // namespace Gaffer
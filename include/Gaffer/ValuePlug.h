@@ -41,6 +41,9 @@
 
 #include "IECore/Object.h"
 
+#include <atomic>
+#include <map>
+
 namespace Gaffer
 {
 
@@ -129,7 +132,16 @@ class GAFFER_API ValuePlug : public Plug
 			/// Suitable for relatively lightweight processes that could benefit
 			/// from caching, but do not spawn TBB tasks, and are unlikely to be
 			/// required from multiple threads concurrently.
-			Default
+			Default,
+			/// As for TaskCollaboration, but results are additionally stored
+			/// in the persistent cache, if one has been enabled using
+			/// `setPersistentCacheDirectory()`. Because the persistent cache
+			/// may be shared between processes, this must only be used for
+			/// computes whose hash depends on nothing but the inputs to the
+			/// compute. Suitable for expensive processes such as file loading.
+			/// When used as a hash cache policy, this is equivalent to
+			/// TaskCollaboration.
+			Persistent
 		};
 
 		/// @name Cache management
@@ -146,6 +158,71 @@ class GAFFER_API ValuePlug : public Plug
 		static size_t cacheMemoryUsage();
 		/// Clears the cache.
 		static void clearCache();
+
+		/// Determines how values are chosen for eviction when the cache
+		/// exceeds its memory limit.
+		enum class CacheEvictionMode
+		{
+			/// Values which have not been used recently are evicted first.
+			LeastRecentlyUsed,
+			/// As for LeastRecentlyUsed, but values which were expensive to
+			/// compute relative to their memory usage are retained for longer.
+			/// This requires the duration of each compute to be measured,
+			/// which adds a small overhead.
+			CostWeighted
+		};
+		static void setCacheEvictionMode( CacheEvictionMode mode );
+		static CacheEvictionMode getCacheEvictionMode();
+		//@}
+
+		/// @name Direct evaluation
+		/// For very cheap computes, the overhead of hashing and looking up
+		/// the cache can exceed the cost of the compute itself. When automatic
+		/// direct evaluation is enabled, the hash and compute durations are
+		/// sampled for each output plug using `CachePolicy::Default`. Plugs
+		/// which are found to be cheaper to compute than to look up are
+		/// thereafter evaluated directly, bypassing the hash and the cache
+		/// as for `CachePolicy::Uncached`. Direct evaluations continue to be
+		/// sampled occasionally, and a plug reverts to caching permanently if
+		/// it is found to be more expensive than originally measured. The
+		/// behaviour may be overridden for individual nodes using
+		/// `ComputeNode::setDirectEvaluation()`.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		static void setAutomaticDirectEvaluationEnabled( bool enabled );
+		static bool getAutomaticDirectEvaluationEnabled();
+		/// Returns true if profiling has determined that `plug` should be
+		/// evaluated directly. Intended for debugging and testing.
+		static bool isDirectlyEvaluated( const ValuePlug *plug );
+		//@}
+
+		/// @name Persistent cache management
+		/// Values computed by nodes using `CachePolicy::Persistent` may
+		/// additionally be stored on disk, providing a second-level cache
+		/// that is consulted when a value is not found in the memory cache.
+		/// Values are stored in one file per compute hash, so the cache
+		/// may be shared between several processes on the same host.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Returns the directory used for the persistent cache. An empty
+		/// string means that the persistent cache is disabled.
+		static std::string getPersistentCacheDirectory();
+		/// Sets the directory used for the persistent cache, creating it if
+		/// necessary. Pass an empty string to disable the persistent cache.
+		static void setPersistentCacheDirectory( const std::string &directory );
+		/// Returns the maximum amount of disk space in bytes to use for the
+		/// persistent cache.
+		static size_t getPersistentCacheSizeLimit();
+		/// Sets the maximum amount of disk space the persistent cache may use
+		/// in bytes. When the limit is exceeded, the least recently used files
+		/// are removed.
+		static void setPersistentCacheSizeLimit( size_t bytes );
+		/// Returns the disk space in bytes currently used by the persistent
+		/// cache. This is approximate, because the cache may also be modified
+		/// by other processes.
+		static size_t persistentCacheUsage();
+		/// Removes all files from the persistent cache.
+		static void clearPersistentCache();
 		//@}
 
 		/// @name Hash cache management
@@ -156,9 +233,10 @@ class GAFFER_API ValuePlug : public Plug
 		//@{
 		static size_t getHashCacheSizeLimit();
 		/// > Note : Limits are applied on a per-thread basis as and
-		/// > when each thread is used to compute a hash.
+		/// > when each thread is used to compute a hash, except when using
+		/// > `HashCacheScope::Shared`, where the limit applies to the shared cache.
 		static void setHashCacheSizeLimit( size_t maxEntriesPerThread );
-		/// Returns the total number of entries in both global and per-thread hash caches
+		/// Returns the total number of entries in the global, per-thread and shared hash caches
 		static size_t hashCacheTotalUsage();
 		/// Clears the hash cache.
 		/// > Note : By default, clearing occurs on a per-thread basis as
@@ -182,6 +260,71 @@ class GAFFER_API ValuePlug : public Plug
 		static void setHashCacheMode( HashCacheMode hashCacheMode );
 		static HashCacheMode getHashCacheMode();
 
+		/// Determines how cached hashes are shared between threads.
+		enum class HashCacheScope
+		{
+			/// Each thread has its own cache, so a hash may be computed
+			/// redundantly by several threads, and the size limit applies
+			/// to each thread individually.
+			PerThread,
+			/// A single cache is shared by all threads, and the size limit
+			/// applies to the cache as a whole. Lookups are lock-free, but
+			/// the cache is lossy : a new entry replaces any existing entry
+			/// that maps to the same slot.
+			Shared
+		};
+		static void setHashCacheScope( HashCacheScope scope );
+		static HashCacheScope getHashCacheScope();
+
+		//@}
+
+		/// @name Cache statistics
+		/// Statistics describing the effectiveness of the compute and hash
+		/// caches, intended to aid in the tuning of the limits above.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		struct CacheStatistics
+		{
+			/// The number of lookups that found a result in the cache.
+			size_t hits = 0;
+			/// The number of lookups that did not find a result in the cache.
+			size_t misses = 0;
+			/// The number of misses that were resolved by waiting for
+			/// another thread to compute the same result.
+			size_t collaborations = 0;
+			/// The number of entries removed from the cache, either to
+			/// remain within the limit or due to clearing.
+			size_t evictions = 0;
+		};
+		/// Returns statistics for the compute cache, accumulated since the
+		/// last call to `resetCacheStatistics()`.
+		static CacheStatistics computeCacheStatistics();
+		/// Returns statistics for the hash cache, accumulated since the
+		/// last call to `resetCacheStatistics()`. Hits and evictions are
+		/// counted for both the global and per-thread caches.
+		static CacheStatistics hashCacheStatistics();
+		static void resetCacheStatistics();
+
+		/// Memory usage for a group of entries in the compute cache.
+		struct CacheUsage
+		{
+			size_t entries = 0;
+			size_t bytes = 0;
+		};
+		/// Maps from `( nodeTypeName, plugName )` to the memory used by the
+		/// results of that plug, summed over all nodes of that type. Plug names
+		/// are relative to the node.
+		using CacheUsageMap = std::map<std::pair<IECore::InternedString, IECore::InternedString>, CacheUsage>;
+		/// Enables tracking of compute cache memory usage by node type and
+		/// plug name. This adds a small overhead to every insertion into and
+		/// removal from the cache, so is off by default. Only entries added
+		/// while tracking is enabled are accounted for.
+		static void setCacheUsageTrackingEnabled( bool enabled );
+		static bool getCacheUsageTrackingEnabled();
+		/// Returns the current compute cache memory usage by node type and
+		/// plug name. Where hashes are shared by several plugs, the entry is
+		/// attributed to the plug that first computed it.
+		static CacheUsageMap cacheMemoryUsageByNodeType();
 		//@}
 
 		/// Returns a counter that increments when this plug is been dirtied
@@ -254,6 +397,7 @@ class GAFFER_API ValuePlug : public Plug
 		class HashProcess;
 		class ComputeProcess;
 		class SetValueAction;
+		struct EvaluationProfile;
 
 		const IECore::Object *getValueInternal( IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash = nullptr ) const;
 		void setValueInternal( IECore::ConstObjectPtr value, bool propagateDirtiness );
@@ -269,6 +413,9 @@ class GAFFER_API ValuePlug : public Plug
 		// into the hash cache, so that previous entries are invalidated when
 		// the plug is dirtied.
 		uint64_t m_dirtyCount;
+		// Used by automatic direct evaluation. Allocated on demand, the first
+		// time the plug is computed while profiling is enabled.
+		mutable std::atomic<EvaluationProfile *> m_evaluationProfile;
 
 };
 
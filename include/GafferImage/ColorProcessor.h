@@ -88,6 +88,12 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		Gaffer::ObjectPlug *colorProcessorPlug();
 		const Gaffer::ObjectPlug *colorProcessorPlug() const;
 
+		// Returns the plug that the RGB data for `layerName` should be read
+		// from, and fills `upstreamProcessors` with the functions of upstream
+		// ColorProcessors that must be applied to it before our own. This allows
+		// chains of ColorProcessors to be evaluated in a single pass.
+		const ImagePlug *fusedInput( const Gaffer::Context *context, const std::string &layerName, const std::vector<std::string> &channelNames, bool unpremult, std::vector<ColorProcessorFunction> &upstreamProcessors ) const;
+
 		// Used to store the result of processColorData(), so that it can be reused in computeChannelData().
 		// Evaluated in a context with an "image:colorProcessor:__layerName" variable, so we can cache
 		// different results per layer.
@@ -255,6 +255,14 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *emptyTile();
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
+		/// Returns a flat tile with all pixels set to `value`. Tiles are shared
+		/// between callers, and are accounted for compactly by the compute cache
+		/// because only a single copy is stored in memory. `blackTile()` and
+		/// `whiteTile()` are also stored in this way.
+		static IECore::ConstFloatVectorDataPtr constantTile( float value );
+		/// Returns true if `tile` is a flat tile with all pixels set to the
+		/// same value, which is returned in `value`.
+		static bool isConstantTile( const IECore::FloatVectorData *tile, float &value );
 
 		static constexpr int tileSize() { return 1 << tileSizeLog2(); };
 		static constexpr int tilePixels() { return tileSize() * tileSize(); };
@@ -46,6 +46,7 @@
 #include "OpenColorIO/OpenColorTypes.h"
 
 #include <functional>
+#include <memory>
 
 namespace Gaffer
 {
@@ -115,9 +116,18 @@ class GAFFERIMAGE_API ImageWriter : public GafferDispatch::TaskNode
 
 		IECore::MurmurHash hash( const Gaffer::Context *context ) const override;
 		void execute() const override;
+		/// Overlaps the writing of each frame with the computation of the next.
+		void executeSequence( const std::vector<float> &frames ) const override;
 
 	private :
 
+		// Opens the file and gathers all tiles, returning a handle to the
+		// writes that are still pending. These are completed in the
+		// background, and must be finished by calling `close()` on the
+		// handle.
+		class WriteHandle;
+		std::shared_ptr<WriteHandle> startWrite() const;
+
 		std::string colorSpace( const std::string &dataType ) const;
 
 		ColorSpace *colorSpaceNode();
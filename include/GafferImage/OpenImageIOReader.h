@@ -92,6 +92,21 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
 
+		/// Limits the memory used for reading tile batches ahead of demand.
+		/// When tiles are requested in a predictable order, as they are by
+		/// `ImageAlgo::parallelGatherTiles()`, upcoming tile batches are read
+		/// on a dedicated pool of I/O threads, overlapping file access with
+		/// processing. A limit of 0 disables prefetching. The default limit
+		/// is 0, unless a limit in megabytes is provided by the
+		/// `GAFFERIMAGE_OPENIMAGEIOREADER_PREFETCH_MEMORY_LIMIT` environment
+		/// variable.
+		static void setPrefetchMemoryLimit( size_t bytes );
+		static size_t getPrefetchMemoryLimit();
+		/// Returns the total number of tile batches that have been read ahead
+		/// of demand, and the number of those that were later used.
+		static size_t prefetchedTileBatches();
+		static size_t usedPrefetchedTileBatches();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
@@ -83,6 +83,9 @@ class GAFFERIMAGE_API Resize : public ImageProcessor
 		Gaffer::BoolPlug *filterDeepPlug();
 		const Gaffer::BoolPlug *filterDeepPlug() const;
 
+		Gaffer::BoolPlug *usePyramidPlug();
+		const Gaffer::BoolPlug *usePyramidPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -113,6 +116,21 @@ class GAFFERIMAGE_API Resize : public ImageProcessor
 		ImagePlug *resampledInPlug();
 		const ImagePlug *resampledInPlug() const;
 
+		// When `usePyramid` is on, large downscales are performed
+		// in two stages. First the input is box filtered by a power
+		// of two, and then the Resample node filters the remainder.
+		// The box filtered levels are computed lazily on `pyramidPlug()`,
+		// with each level computed from the tiles of the level above
+		// so that they are shared via the compute cache. The level
+		// read by the Resample node is provided by `pyramidLevelPlug()`.
+		Gaffer::IntPlug *pyramidLevelPlug();
+		const Gaffer::IntPlug *pyramidLevelPlug() const;
+
+		ImagePlug *pyramidPlug();
+		const ImagePlug *pyramidPlug() const;
+
+		int pyramidLevel( const Gaffer::Context *context ) const;
+
 		// When we're actually changing the format, we get our
 		// output from resampledInPlug(), but when the format
 		// happens to be the same as the input, we simply pass
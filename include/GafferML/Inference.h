@@ -41,6 +41,7 @@
 
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/ComputeNode.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/TypedObjectPlug.h"
 
@@ -68,6 +69,18 @@ class GAFFERML_API Inference : public Gaffer::ComputeNode
 		Gaffer::ArrayPlug *outPlug();
 		const Gaffer::ArrayPlug *outPlug() const;
 
+		Gaffer::BoolPlug *tiledPlug();
+		const Gaffer::BoolPlug *tiledPlug() const;
+
+		Gaffer::IntPlug *tileSizePlug();
+		const Gaffer::IntPlug *tileSizePlug() const;
+
+		Gaffer::IntPlug *tileOverlapPlug();
+		const Gaffer::IntPlug *tileOverlapPlug() const;
+
+		Gaffer::IntPlug *tileBatchSizePlug();
+		const Gaffer::IntPlug *tileBatchSizePlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -41,6 +41,7 @@
 
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/NumericPlug.h"
+#include "Gaffer/TypedObjectPlug.h"
 
 #include "IECore/PathMatcher.h"
 
@@ -68,6 +69,14 @@ class GAFFERSCENE_API Filter : public Gaffer::ComputeNode
 		FilterPlug *outPlug();
 		const FilterPlug *outPlug() const;
 
+		/// When on, the filter is evaluated for the entire input scene in
+		/// a single parallel traversal, and the results are cached. The result
+		/// for each location is then a simple lookup, which is beneficial
+		/// when an expensive filter is shared by many nodes. The traversal is
+		/// repeated whenever the filter or the input scene changes.
+		Gaffer::BoolPlug *cacheMatchesPlug();
+		const Gaffer::BoolPlug *cacheMatchesPlug() const;
+
 		/// > Note : `affects()` receives special treatment for Filter nodes. In addition to the
 		/// > regular calls where `input` is a plug belonging to the filter, calls are also made
 		/// > where `input` is a child of a ScenePlug that will later be provided to `computeMatch()`.
@@ -88,6 +97,7 @@ class GAFFERSCENE_API Filter : public Gaffer::ComputeNode
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 		/// Implemented to disable compute caching for the filter result.
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
 
 		/// Hash method for outPlug(). A derived class must either :
 		///
@@ -114,6 +124,19 @@ class GAFFERSCENE_API Filter : public Gaffer::ComputeNode
 	private :
 
 		bool enabled( const Gaffer::Context *context ) const;
+		bool cacheMatches( const Gaffer::Context *context ) const;
+
+		IE_CORE_FORWARDDECLARE( MatchesData );
+
+		/// MatchesData holding the results of the filter for every location
+		/// in the input scene. Used when `cacheMatchesPlug()` is on, and must be
+		/// evaluated in a context with the input scene but without `scene:path`.
+		Gaffer::ObjectPlug *matchesPlug();
+		const Gaffer::ObjectPlug *matchesPlug() const;
+		/// Call `matchesPlug()->hash()` and `matchesPlug()->getValue()` in a
+		/// clean context. These must be used for all access to `matchesPlug()`.
+		void matchesHash( const Gaffer::Context *context, IECore::MurmurHash &h ) const;
+		ConstMatchesDataPtr matches( const Gaffer::Context *context ) const;
 
 		friend class FilterPlug;
 
@@ -75,7 +75,9 @@ class GAFFERSCENE_API SceneWriter : public GafferDispatch::TaskNode
 		void execute() const override;
 
 		/// Re-implemented to open the file for writing, then iterate through the
-		/// frames, modifying the current Context and calling writeLocation().
+		/// frames, modifying the current Context and computing each frame while the
+		/// previous one is written on a separate thread. Values which are unchanged
+		/// since the previous frame are neither recomputed nor rewritten.
 		void executeSequence( const std::vector<float> &frames ) const override;
 
 		/// Re-implemented to return true, since the entire file must be written at once.
@@ -190,5 +190,6 @@ GAFFERTEST_API void testContextHashPerformance( int numEntries, int entrySize, b
 GAFFERTEST_API void testContextCopyPerformance( int numEntries, int entrySize );
 GAFFERTEST_API void testCopyEditableScope();
 GAFFERTEST_API void testContextHashValidation();
+GAFFERTEST_API void testEditableScopeReuse();
 
 } // namespace GafferTest
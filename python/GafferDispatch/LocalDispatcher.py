@@ -43,7 +43,9 @@ import os
 import re
 import signal
 import shlex
+import shutil
 import subprocess
+import tempfile
 import threading
 import time
 import traceback
@@ -64,6 +66,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		self["executeInBackground"] = Gaffer.BoolPlug( defaultValue = False )
 		self["ignoreScriptLoadErrors"] = Gaffer.BoolPlug( defaultValue = False )
 		self["environmentCommand"] = Gaffer.StringPlug()
+		self["sharedComputeCache"] = Gaffer.BoolPlug( defaultValue = False )
 
 		self.__jobPool = jobPool if jobPool else LocalDispatcher.defaultJobPool()
 
@@ -91,6 +94,8 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__ignoreScriptLoadErrors = dispatcher["ignoreScriptLoadErrors"].getValue()
 			self.__environmentCommand = dispatcher["environmentCommand"].getValue()
 			self.__executeInBackground = dispatcher["executeInBackground"].getValue()
+			self.__sharedComputeCache = dispatcher["sharedComputeCache"].getValue()
+			self.__sharedComputeCacheDirectory = None
 
 			# We want to warn if a Task is executing in the foreground and the `isolate` plug
 			# is enabled, which are mutually exclusive. We want to warn once per dispatch per
@@ -222,7 +227,10 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			with self.__messageHandler :
 				self.__updateStatus( self.Status.Running )
 				try :
-					self.__executeWalk( self.__rootBatch, canceller )
+					try :
+						self.__executeWalk( self.__rootBatch, canceller )
+					finally :
+						self.__removeSharedComputeCache()
 				except IECore.Cancelled :
 					self.__updateStatus( self.Status.Killed )
 				except :
@@ -324,6 +332,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			env = Gaffer.environment()
 			env["IECORE_LOG_LEVEL"] = "DEBUG"
 
+			if self.__sharedComputeCache :
+				self.__addSharedComputeCacheEnvironment( env )
+
 			# Launch process.
 
 			IECore.msg( IECore.Msg.Level.Debug, batch.blindData()["nodeName"].value, "Executing `{}`".format( " ".join( args ) ) )
@@ -388,6 +399,46 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				self.__currentProcess = None
 				outputHandler.join()
 
+		# Gives all the background processes for the job a common persistent
+		# cache, so that values computed by one process can be reused by the
+		# next, rather than each process starting with an empty cache. We
+		# use shared memory for the cache where it is available.
+		def __addSharedComputeCacheEnvironment( self, env ) :
+
+			if "GAFFER_PERSISTENT_CACHE_DIRECTORY" in env :
+				# The user has provided their own persistent cache,
+				# which will already be shared between processes.
+				pass
+			else :
+				if self.__sharedComputeCacheDirectory is None :
+					sharedMemory = "/dev/shm"
+					self.__sharedComputeCacheDirectory = tempfile.mkdtemp(
+						prefix = "gafferComputeCache-{}-".format( self.__id ),
+						dir = sharedMemory if os.path.isdir( sharedMemory ) else None
+					)
+				env["GAFFER_PERSISTENT_CACHE_DIRECTORY"] = self.__sharedComputeCacheDirectory
+				# Shared memory counts against physical memory, so we
+				# limit usage accordingly.
+				env.setdefault(
+					"GAFFER_PERSISTENT_CACHE_SIZE_LIMIT",
+					str( min( 1024 * 8, psutil.virtual_memory().total // 1024**2 // 8 ) )
+				)
+				# Opt in the nodes whose computes are most expensive to repeat.
+				# Their hashes include file names but not file contents, so we
+				# only do this for our own cache, which lives no longer than the
+				# job. A long-lived cache would return stale results after a file
+				# is rewritten.
+				env.setdefault( "GAFFERSCENE_SCENEREADER_OBJECT_CACHEPOLICY", "Persistent" )
+				env.setdefault( "GAFFERIMAGE_OPENIMAGEIOREADER_TILEBATCH_CACHEPOLICY", "Persistent" )
+
+		def __removeSharedComputeCache( self ) :
+
+			if self.__sharedComputeCacheDirectory is None :
+				return
+
+			shutil.rmtree( self.__sharedComputeCacheDirectory, ignore_errors = True )
+			self.__sharedComputeCacheDirectory = None
+
 		def __initBatchWalk( self, batch ) :
 
 			## \todo `TaskBatch.Namer` is computing this as
@@ -41,6 +41,7 @@ import os
 import stat
 import shutil
 import unittest
+import unittest.mock
 import time
 import inspect
 import functools
@@ -815,6 +816,65 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 		with open( testFile, encoding = "utf-8" ) as f :
 			self.assertEqual( f.readlines(), [ "HELLO WORLD\n" ] )
 
+	@unittest.skipIf( os.name == "nt", "Uses Unix shell syntax" )
+	def testSharedComputeCache( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		testFile = self.temporaryDirectory() / "test"
+
+		s["c"] = GafferDispatch.SystemCommand()
+		s["c"]["command"].setValue(
+			rf"echo $GAFFER_PERSISTENT_CACHE_DIRECTORY $GAFFERSCENE_SCENEREADER_OBJECT_CACHEPOLICY > {testFile}"
+		)
+
+		s["dispatcher"] = self.__createLocalDispatcher()
+		s["dispatcher"]["executeInBackground"].setValue( True )
+		s["dispatcher"]["framesMode"].setValue( GafferDispatch.Dispatcher.FramesMode.CurrentFrame )
+		s["dispatcher"]["tasks"][0].setInput( s["c"]["task"] )
+
+		# Off by default.
+
+		self.assertFalse( s["dispatcher"]["sharedComputeCache"].getValue() )
+		with unittest.mock.patch.dict( os.environ ) :
+			os.environ.pop( "GAFFER_PERSISTENT_CACHE_DIRECTORY", None )
+			os.environ.pop( "GAFFERSCENE_SCENEREADER_OBJECT_CACHEPOLICY", None )
+			s["dispatcher"]["task"].execute()
+			s["dispatcher"].jobPool().waitForAll()
+
+		with open( testFile, encoding = "utf-8" ) as f :
+			self.assertEqual( f.read().strip(), "" )
+
+		# When on, background processes are given a common cache
+		# directory, which is removed when the job completes.
+
+		s["dispatcher"]["sharedComputeCache"].setValue( True )
+		with unittest.mock.patch.dict( os.environ ) :
+			os.environ.pop( "GAFFER_PERSISTENT_CACHE_DIRECTORY", None )
+			os.environ.pop( "GAFFERSCENE_SCENEREADER_OBJECT_CACHEPOLICY", None )
+			s["dispatcher"]["task"].execute()
+			s["dispatcher"].jobPool().waitForAll()
+
+		with open( testFile, encoding = "utf-8" ) as f :
+			directory, cachePolicy = f.read().split()
+
+		self.assertIn( "gafferComputeCache-", directory )
+		self.assertFalse( os.path.exists( directory ) )
+		self.assertEqual( cachePolicy, "Persistent" )
+
+		# An existing persistent cache directory is respected, and because
+		# it may outlive the files read by the job, readers are not opted in
+		# to it.
+
+		cacheDirectory = self.temporaryDirectory() / "cache"
+		with unittest.mock.patch.dict( os.environ, { "GAFFER_PERSISTENT_CACHE_DIRECTORY" : str( cacheDirectory ) } ) :
+			os.environ.pop( "GAFFERSCENE_SCENEREADER_OBJECT_CACHEPOLICY", None )
+			s["dispatcher"]["task"].execute()
+			s["dispatcher"].jobPool().waitForAll()
+
+		with open( testFile, encoding = "utf-8" ) as f :
+			self.assertEqual( f.read().split(), [ str( cacheDirectory ) ] )
+
 	def testScaling( self ) :
 
 		# See DispatcherTest.testScaling for details.
@@ -97,6 +97,22 @@ Gaffer.Metadata.registerNode(
 
 		},
 
+		"sharedComputeCache" : {
+
+			"description" :
+			"""
+			Shares computed values between the separate processes used to execute
+			tasks in the background, so that values computed by one task can be
+			reused by subsequent tasks rather than being computed again. This can
+			significantly speed up dispatches where many tasks read the same
+			scenes or images. Values are stored in shared memory where available,
+			and are removed when the job completes.
+			""",
+
+			"layout:activator" : "executeInBackgroundIsOn",
+
+		},
+
 	}
 
 )
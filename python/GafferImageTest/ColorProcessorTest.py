@@ -0,0 +1,168 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+import imath
+
+import IECore
+
+import Gaffer
+import GafferTest
+import GafferImage
+import GafferImageTest
+
+class ColorProcessorTest( GafferImageTest.ImageTestCase ) :
+
+	def __chain( self, input, fused = True ) :
+
+		# Grade isn't a ColorProcessor, so inserting an identity Grade between
+		# each node prevents fusion, giving us a reference to compare with.
+
+		def separator( plug ) :
+
+			if fused :
+				return plug
+
+			grade = GafferImage.Grade()
+			grade["in"].setInput( plug )
+			self.__nodes.append( grade )
+			return grade["out"]
+
+		saturation1 = GafferImage.Saturation()
+		saturation1["in"].setInput( input )
+		saturation1["saturation"].setValue( 0.5 )
+
+		cdl = GafferImage.CDL()
+		cdl["in"].setInput( separator( saturation1["out"] ) )
+		cdl["slope"].setValue( imath.Color3f( 1.5, 1.2, 0.8 ) )
+		cdl["offset"].setValue( imath.Color3f( 0.1, 0, -0.1 ) )
+
+		saturation2 = GafferImage.Saturation()
+		saturation2["in"].setInput( separator( cdl["out"] ) )
+		saturation2["saturation"].setValue( 1.5 )
+
+		self.__nodes.extend( [ saturation1, cdl, saturation2 ] )
+		return saturation1, cdl, saturation2
+
+	def setUp( self ) :
+
+		GafferImageTest.ImageTestCase.setUp( self )
+		self.__nodes = []
+
+	def testFusion( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "circles.exr" )
+
+		saturation1, cdl, saturation2 = self.__chain( reader["out"] )
+		reference = self.__chain( reader["out"], fused = False )[2]
+
+		self.assertImagesEqual( saturation2["out"], reference["out"] )
+
+		# Upstream nodes in the chain shouldn't have needed to
+		# compute their own colour data.
+
+		Gaffer.ValuePlug.clearCache()
+		monitor = Gaffer.PerformanceMonitor()
+		with monitor :
+			GafferImageTest.processTiles( saturation2["out"] )
+
+		self.assertEqual( monitor.plugStatistics( saturation1["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( cdl["__colorData"] ).computeCount, 0 )
+		self.assertGreater( monitor.plugStatistics( saturation2["__colorData"] ).computeCount, 0 )
+
+	def testNoFusionForPartialChannels( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "circles.exr" )
+
+		saturation1, cdl, saturation2 = self.__chain( reader["out"] )
+		referenceSaturation1, referenceCDL, referenceSaturation2 = self.__chain( reader["out"], fused = False )
+
+		for node in ( saturation1, referenceSaturation1 ) :
+			node["channels"].setValue( "R" )
+
+		self.assertImagesEqual( saturation2["out"], referenceSaturation2["out"] )
+
+	def testNoFusionForMissingChannels( self ) :
+
+		constant = GafferImage.Constant()
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( constant["out"] )
+		deleteChannels["channels"].setValue( "G" )
+
+		saturation1, cdl, saturation2 = self.__chain( deleteChannels["out"] )
+		reference = self.__chain( deleteChannels["out"], fused = False )[2]
+
+		self.assertImagesEqual( saturation2["out"], reference["out"] )
+
+	def testFusionWithDisabledAndUnpremultipliedNodes( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "circles.exr" )
+
+		saturation1, cdl, saturation2 = self.__chain( reader["out"] )
+		referenceSaturation1, referenceCDL, referenceSaturation2 = self.__chain( reader["out"], fused = False )
+
+		for node in ( cdl, referenceCDL ) :
+			node["enabled"].setValue( False )
+		self.assertImagesEqual( saturation2["out"], referenceSaturation2["out"] )
+
+		for node in ( cdl, referenceCDL ) :
+			node["enabled"].setValue( True )
+			node["processUnpremultiplied"].setValue( True )
+		self.assertImagesEqual( saturation2["out"], referenceSaturation2["out"] )
+
+		for node in ( saturation1, saturation2, referenceSaturation1, referenceSaturation2 ) :
+			node["processUnpremultiplied"].setValue( True )
+		self.assertImagesEqual( saturation2["out"], referenceSaturation2["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testChainPerformance( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 4000, 4000 ) )
+
+		saturation1, cdl, saturation2 = self.__chain( checkerboard["out"] )
+		GafferImageTest.processTiles( checkerboard["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( saturation2["out"] )
+
+if __name__ == "__main__":
+	unittest.main()
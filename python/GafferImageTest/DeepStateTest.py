@@ -435,6 +435,48 @@ class DeepStateTest( GafferImageTest.ImageTestCase ) :
 					self.assertEqual( len( channelData ), expectedSampleCount, "State : {}, Channel : {}, Values : {}".format( deepState, channel, nodes["values"] ) )
 					self.assertSimilarList( channelData, expectedData, 0.00001,  "State : {}, Channel : {}, Values : {}".format( deepState, channel, nodes["values"] ) )
 
+	def testVaryingSampleCountsBetweenTiles( self ) :
+
+		# Scratch memory is reused from one tile to the next, so check
+		# successive tiles with more and fewer samples than the last.
+
+		values = [
+			{ "R" : 0.25, "G" : 0.5, "B" : 1.0, "A" : 0.5, "Z" : 4, "ZBack" : 6 },
+			{ "R" : 2.0, "G" : 3.0, "B" : 4.0, "A" : 0.25, "Z" : 1, "ZBack" : 5 },
+			{ "R" : 0.0, "G" : 0.5, "B" : 0.1, "A" : 0.75, "Z" : 3, "ZBack" : 3 },
+			{ "R" : 1.0, "G" : 1.5, "B" : 0.5, "A" : 0.5, "Z" : 2, "ZBack" : 7 },
+		]
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+
+		# Each sample covers one less column of tiles than the one before it,
+		# so the tile at `x = i * tileSize` has `len( values ) - i` samples
+		# per pixel.
+		nodes = []
+		merge = GafferImage.DeepMerge()
+		for i, v in enumerate( values ) :
+			c, d = self.__getConstant( dim = imath.V2i( tileSize * ( len( values ) - i ), tileSize ), **v )
+			nodes.extend( [ c, d ] )
+			merge["in"][i].setInput( d["out"] )
+
+		st = GafferImage.DeepState()
+		st["in"].setInput( merge["out"] )
+
+		for deepState in [ GafferImage.DeepState.TargetState.Sorted, GafferImage.DeepState.TargetState.Tidy, GafferImage.DeepState.TargetState.Flat ] :
+			st["deepState"].setValue( deepState )
+			for i in [ 0, 3, 1, 0, 2, 3, 1 ] :
+
+				Gaffer.ValuePlug.clearCache()
+
+				tileOrigin = imath.V2i( i * tileSize, 0 )
+				expectedValues = self.__getModifiedSamples( copy.deepcopy( values[:len( values ) - i] ), deepState )
+
+				for channel in [ "R", "G", "B", "A", "Z", "ZBack" ] :
+					expectedData = IECore.FloatVectorData( [ v[channel] for v in expectedValues ] * tileSize * tileSize )
+					channelData = st["out"].channelData( channel, tileOrigin )
+					self.assertEqual( len( channelData ), len( expectedData ), "State : {}, Tile : {}, Channel : {}".format( deepState, i, channel ) )
+					self.assertSimilarList( channelData, expectedData, 0.00001, "State : {}, Tile : {}, Channel : {}".format( deepState, i, channel ) )
+
 	def assertSimilarList( self, actual, expected, tolerance, msg = None ) :
 		self.assertEqual( len( actual ), len( expected ) )
 		for i in range( len( actual ) ) :
@@ -1026,3 +1068,29 @@ class DeepStateTest( GafferImageTest.ImageTestCase ) :
 		deleteChannels["channels"].setValue( "[Z]" ) # Removing just Z has the same effect
 
 		self.__assertDeepStateProcessing( deleteChannels["out"], referenceFlatten["out"], [ 0, 0, 0, 10 ], [ 0, 0, 0, 10 ], 100, 0.45 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManySamplesPerPixelPerformance( self ) :
+
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		# Merge interleaved copies of the image, giving unsorted, overlapping
+		# samples and many samples per pixel.
+		depthGrades = []
+		deepMerge = GafferImage.DeepMerge()
+		for i in range( 16 ) :
+			depthGrade = self.__createDepthGrade()
+			depthGrade["in"].setInput( representativeImage["out"] )
+			depthGrade["depthOffset"].setValue( ( i * 7 ) % 16 * 0.01 )
+			deepMerge["in"][i].setInput( depthGrade["out"] )
+			depthGrades.append( depthGrade )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( deepMerge["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Flat )
+
+		GafferImageTest.processTiles( deepMerge["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( deepState["out"] )
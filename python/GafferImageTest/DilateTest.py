@@ -383,6 +383,10 @@ class DilateTest( GafferImageTest.ImageTestCase ) :
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
 
+	def testWideRadius( self ) :
+
+		self.assertRankFilterMatchesDriverChannel( GafferImage.Dilate() )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
 	def testPerf( self ) :
 
@@ -338,6 +338,10 @@ class ErodeTest( GafferImageTest.ImageTestCase ) :
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
 
+	def testWideRadius( self ) :
+
+		self.assertRankFilterMatchesDriverChannel( GafferImage.Erode() )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
 	def testPerf( self ) :
 
@@ -42,6 +42,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 
@@ -306,3 +307,21 @@ class GradeTest( GafferImageTest.ImageTestCase ) :
 		defaultGrade["gamma"].setValue( imath.Color4f( 2, 2, 2, 1.0 ) )
 
 		self.assertImagesEqual( unpremultipliedGrade["out"], defaultGrade["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 4000, 4000 ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( checkerboard["out"] )
+		grade["multiply"].setValue( imath.Color4f( 2, 1.5, 0.5, 1 ) )
+		grade["offset"].setValue( imath.Color4f( -0.1, 0.1, 0.2, 0 ) )
+		grade["blackClamp"].setValue( True )
+		grade["whiteClamp"].setValue( True )
+
+		GafferImageTest.processTiles( checkerboard["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( grade["out"] )
@@ -248,6 +248,47 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
 
+	def testConstantTile( self ) :
+
+		ts = GafferImage.ImagePlug.tileSize()
+		for value in ( 0.0, 1.0, 0.5, -2.0 ) :
+			tileA = GafferImage.ImagePlug.constantTile( value, _copy = False )
+			tileB = GafferImage.ImagePlug.constantTile( value, _copy = False )
+			self.__testTileData( tileA, ts*ts, value = value )
+			self.assertTrue( tileA.isSame( tileB ) )
+			self.assertTrue( GafferImage.ImagePlug.isConstantTile( tileA ) )
+			self.assertTrue( GafferImage.ImagePlug.isConstantTile( GafferImage.ImagePlug.constantTile( value ) ) )
+
+		self.assertTrue( GafferImage.ImagePlug.constantTile( 0, _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.constantTile( 1, _copy = False ).isSame( GafferImage.ImagePlug.whiteTile( _copy = False ) ) )
+		self.assertFalse( GafferImage.ImagePlug.constantTile( -0.0, _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+
+		# Memory usage is reported in full, because a tile may be the only
+		# user of its storage.
+		self.assertGreater( GafferImage.ImagePlug.constantTile( 0.5, _copy = False ).memoryUsage(), ts * ts * 4 )
+		self.assertGreater( GafferImage.ImagePlug.constantTile( 0.5 ).memoryUsage(), ts * ts * 4 )
+
+		tile = GafferImage.ImagePlug.constantTile( 0.5 )
+		tile[10] = 0.25
+		self.assertFalse( GafferImage.ImagePlug.isConstantTile( tile ) )
+		self.assertFalse( GafferImage.ImagePlug.isConstantTile( GafferImage.ImagePlug.emptyTile() ) )
+
+	def testUniformTilesAreShared( self ) :
+
+		constant = GafferImage.Constant()
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( constant["out"] )
+		grade["multiply"].setValue( imath.Color4f( 2 ) )
+
+		for channel, value in zip( "RGBA", ( 0.5, 1.0, 1.5, 1.0 ) ) :
+			tileA = grade["out"].channelData( channel, imath.V2i( 0 ), _copy = False )
+			tileB = grade["out"].channelData( channel, imath.V2i( GafferImage.ImagePlug.tileSize() ), _copy = False )
+			self.__testTileData( tileA, GafferImage.ImagePlug.tileSize() ** 2, value = value )
+			self.assertTrue( tileA.isSame( tileB ) )
+			self.assertTrue( tileA.isSame( GafferImage.ImagePlug.constantTile( value, _copy = False ) ) )
+
 	def testEmptyTile( self ) :
 
 		tileDataCopiedA = GafferImage.ImagePlug.emptyTile()
@@ -273,6 +273,38 @@ parent["color"] = imath.Color4f( 0.5, 0.6, 0.7, 0.8 ) if context.get( "collect:l
 		node["in"].setInput( deep["out"] )
 		self.assertRaisesRegex( RuntimeError, 'Deep data not supported in input "in*', GafferImage.ImageAlgo.image, node["out"] )
 
+	def assertRankFilterMatchesDriverChannel( self, node ) :
+
+		# The driver channel code path uses a different algorithm to the
+		# regular one, so comparing them gives us some extra coverage for
+		# radii that span several tiles.
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / "circles.exr" )
+
+		node["in"].setInput( imageReader["out"] )
+		node["boundingMode"].setValue( GafferImage.Sampler.BoundingMode.Clamp )
+
+		driverNode = node.__class__()
+		driverNode["in"].setInput( imageReader["out"] )
+		driverNode["boundingMode"].setValue( GafferImage.Sampler.BoundingMode.Clamp )
+		driverNode["masterChannel"].setValue( "G" )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( node["out"] )
+		deleteChannels["mode"].setValue( GafferImage.DeleteChannels.Mode.Keep )
+		deleteChannels["channels"].setValue( "G" )
+
+		deleteChannelsDriver = GafferImage.DeleteChannels()
+		deleteChannelsDriver["in"].setInput( driverNode["out"] )
+		deleteChannelsDriver["mode"].setValue( GafferImage.DeleteChannels.Mode.Keep )
+		deleteChannelsDriver["channels"].setValue( "G" )
+
+		for radius in [ imath.V2i( 1, 0 ), imath.V2i( 0, 3 ), imath.V2i( 37, 5 ), imath.V2i( 70 ) ] :
+			node["radius"].setValue( radius )
+			driverNode["radius"].setValue( radius )
+			self.assertImagesEqual( deleteChannels["out"], deleteChannelsDriver["out"] )
+
 	@staticmethod
 	def imagesPath() :
 		return Gaffer.rootPath() / "python" / "GafferImageTest" / "images"
@@ -1060,6 +1060,107 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 			os.chmod( self.temporaryDirectory() / "test.tif", 0o444 )
 			self.assertRaisesRegex( RuntimeError, "Could not open", s["w"]["task"].execute )
 
+	def testExecuteSequence( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["c"] = GafferImage.Constant()
+		s["c"]["format"].setValue( GafferImage.Format( 300, 200 ) )
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["c"]["color"]["r"] = context.getFrame() / 8.0' )
+
+		s["w"] = GafferImage.ImageWriter()
+		s["w"]["in"].setInput( s["c"]["out"] )
+
+		s["r"] = GafferImage.ImageReader()
+		s["r"]["fileName"].setInput( s["w"]["fileName"] )
+
+		for mode in ( GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ) :
+
+			with self.subTest( mode = mode ) :
+
+				s["w"]["fileName"].setValue( self.temporaryDirectory() / "test{}.####.exr".format( mode ) )
+				s["w"]["openexr"]["mode"].setValue( mode )
+
+				# Writes for each frame overlap with the computation of the next,
+				# but all frames should be complete by the time we return.
+				s["w"]["task"].executeSequence( [ 1, 2, 3 ] )
+
+				for frame in ( 1, 2, 3 ) :
+					with Gaffer.Context( s.context() ) as c :
+						c.setFrame( frame )
+						self.assertImagesEqual( s["r"]["out"], s["c"]["out"], ignoreMetadata = True )
+
+	def testExecuteSequenceWithSameFileName( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["c"] = GafferImage.Constant()
+		s["c"]["format"].setValue( GafferImage.Format( 300, 200 ) )
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["c"]["color"]["r"] = context.getFrame() / 8.0' )
+
+		# Every frame is written to the same file, so each write must be
+		# complete before the next is started.
+		s["w"] = GafferImage.ImageWriter()
+		s["w"]["in"].setInput( s["c"]["out"] )
+		s["w"]["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
+		s["w"]["task"].executeSequence( [ 1, 2, 3 ] )
+
+		s["r"] = GafferImage.ImageReader()
+		s["r"]["fileName"].setInput( s["w"]["fileName"] )
+
+		with Gaffer.Context( s.context() ) as c :
+			c.setFrame( 3 )
+			self.assertImagesEqual( s["r"]["out"], s["c"]["out"], ignoreMetadata = True )
+
+	def testExecuteSequenceComputeError( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["c"] = GafferImage.Constant()
+		s["c"]["format"].setValue( GafferImage.Format( 300, 200 ) )
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["c"]["color"]["r"] = 1.0 / ( context.getFrame() - 2 )' )
+
+		s["w"] = GafferImage.ImageWriter()
+		s["w"]["in"].setInput( s["c"]["out"] )
+		s["w"]["fileName"].setValue( self.temporaryDirectory() / "test.####.exr" )
+
+		with self.assertRaises( Gaffer.ProcessException ) :
+			s["w"]["task"].executeSequence( [ 1, 2, 3 ] )
+
+		# The error computing frame 2 must not leave frame 1 incomplete.
+
+		s["r"] = GafferImage.ImageReader()
+		s["r"]["fileName"].setInput( s["w"]["fileName"] )
+
+		with Gaffer.Context( s.context() ) as c :
+			c.setFrame( 1 )
+			self.assertImagesEqual( s["r"]["out"], s["c"]["out"], ignoreMetadata = True )
+
+	@unittest.skipIf( not os.path.exists( "/dev/full" ), "Requires /dev/full" )
+	def testExecuteSequenceWriteError( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["c"] = GafferImage.Constant()
+		s["c"]["format"].setValue( GafferImage.Format( 2000, 2000 ) )
+
+		s["w"] = GafferImage.ImageWriter()
+		s["w"]["in"].setInput( s["c"]["out"] )
+		s["w"]["openexr"]["compression"].setValue( "none" )
+
+		# Writing to `/dev/full` fails with `ENOSPC` once the image data is
+		# flushed to it, which happens on the thread performing the writes.
+		# The error must be reported by the task, rather than being lost.
+		for frame in ( 1, 2, 3 ) :
+			( self.temporaryDirectory() / "test.{}.exr".format( frame ) ).symlink_to( "/dev/full" )
+		s["w"]["fileName"].setValue( self.temporaryDirectory() / "test.#.exr" )
+
+		with self.assertRaises( RuntimeError ) :
+			s["w"]["task"].executeSequence( [ 1, 2, 3 ] )
+
 	def testWriteIntermediateFile( self ) :
 
 		# This tests a fairly common usage pattern whereby
@@ -362,6 +362,10 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 		reverseOffset["offset"].setValue( imath.V2i( 1070, -1360 ) )
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
+	def testWideRadius( self ) :
+
+		self.assertRankFilterMatchesDriverChannel( GafferImage.Median() )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
 	def testPerf( self ) :
 
@@ -744,6 +744,75 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		finally :
 			GafferImage.OpenImageIOReader.setOpenFilesLimit( l )
 
+	def testPrefetch( self ) :
+
+		limit = GafferImage.OpenImageIOReader.getPrefetchMemoryLimit()
+		self.addCleanup( GafferImage.OpenImageIOReader.setPrefetchMemoryLimit, limit )
+
+		for fileName in [ "large.exr", "multipart.exr", "representativeDeepImage.exr" ] :
+
+			with self.subTest( fileName = fileName ) :
+
+				reader = GafferImage.OpenImageIOReader()
+				reader["fileName"].setValue( self.imagesPath() / fileName )
+
+				GafferImage.OpenImageIOReader.setPrefetchMemoryLimit( 0 )
+				expected = GafferImage.ImageAlgo.tiles( reader["out"] )
+
+				# Read the tiles again with prefetching enabled, which should
+				# give identical results, whether or not the prefetch budget
+				# is large enough to hold any batches.
+
+				for prefetchLimit in [ 1, 1024 ** 3 ] :
+					GafferImage.OpenImageIOReader.setPrefetchMemoryLimit( prefetchLimit )
+					reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+					Gaffer.ValuePlug.clearCache()
+					prefetched = GafferImage.OpenImageIOReader.prefetchedTileBatches()
+					self.assertEqual( GafferImage.ImageAlgo.tiles( reader["out"] ), expected )
+					if prefetchLimit == 1 :
+						# Budget too small for any batch.
+						self.assertEqual( GafferImage.OpenImageIOReader.prefetchedTileBatches(), prefetched )
+
+	def testPrefetchIsUsed( self ) :
+
+		limit = GafferImage.OpenImageIOReader.getPrefetchMemoryLimit()
+		self.addCleanup( GafferImage.OpenImageIOReader.setPrefetchMemoryLimit, limit )
+		GafferImage.OpenImageIOReader.setPrefetchMemoryLimit( 1024 ** 3 )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.imagesPath() / "large.exr" )
+		reader["refreshCount"].setValue( 1 )
+		Gaffer.ValuePlug.clearCache()
+
+		prefetched = GafferImage.OpenImageIOReader.prefetchedTileBatches()
+		used = GafferImage.OpenImageIOReader.usedPrefetchedTileBatches()
+
+		# Read a column of tiles in order, so that we move from one tile
+		# batch to the next adjacent one. This should trigger prefetching
+		# of the batches below, which should then be used.
+
+		channelName = reader["out"].channelNames()[0]
+		dataWindow = reader["out"].dataWindow()
+		tileSize = GafferImage.ImagePlug.tileSize()
+
+		expected = []
+		for y in range( dataWindow.max().y - 1, dataWindow.min().y - 1, -tileSize ) :
+			tileOrigin = GafferImage.ImagePlug.tileOrigin( imath.V2i( dataWindow.min().x, y ) )
+			expected.append( reader["out"].channelData( channelName, tileOrigin ) )
+
+		self.assertGreater( GafferImage.OpenImageIOReader.prefetchedTileBatches(), prefetched )
+		self.assertGreater( GafferImage.OpenImageIOReader.usedPrefetchedTileBatches(), used )
+
+		# And the prefetched data should be identical to data read directly.
+
+		GafferImage.OpenImageIOReader.setPrefetchMemoryLimit( 0 )
+		reader["refreshCount"].setValue( 2 )
+		Gaffer.ValuePlug.clearCache()
+
+		for i, y in enumerate( range( dataWindow.max().y - 1, dataWindow.min().y - 1, -tileSize ) ) :
+			tileOrigin = GafferImage.ImagePlug.tileOrigin( imath.V2i( dataWindow.min().x, y ) )
+			self.assertEqual( reader["out"].channelData( channelName, tileOrigin ), expected[i] )
+
 	def testSubimageMetadataNotLoaded( self ) :
 
 		reader = GafferImage.ImageReader()
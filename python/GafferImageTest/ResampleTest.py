@@ -167,6 +167,36 @@ class ResampleTest( GafferImageTest.ImageTestCase ) :
 			with self.subTest( fileName = args[0], size = args[1], ftilter = args[2] ):
 				__test( *args )
 
+	def testSeparableMatchesSinglePass( self ) :
+
+		# Filter weights are shared between tiles, so make sure that tiles
+		# with different origins, including those with negative coordinates,
+		# all match the single pass reference implementation.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "resamplePatterns.exr" )
+
+		resample = GafferImage.Resample()
+		resample["in"].setInput( reader["out"] )
+		resample["filter"].setValue( "lanczos3" )
+		resample["boundingMode"].setValue( GafferImage.Sampler.BoundingMode.Clamp )
+
+		singlePass = GafferImage.Resample()
+		singlePass["in"].setInput( reader["out"] )
+		singlePass["matrix"].setInput( resample["matrix"] )
+		singlePass["filter"].setInput( resample["filter"] )
+		singlePass["boundingMode"].setInput( resample["boundingMode"] )
+		singlePass["debug"].setValue( GafferImage.Resample.Debug.SinglePass )
+
+		for matrix in [
+			imath.M33f().scale( imath.V2f( 0.37, 0.5 ) ),
+			imath.M33f().scale( imath.V2f( 2.3, 1.7 ) ).translate( imath.V2f( -81.25, 17.5 ) ),
+			imath.M33f().scale( imath.V2f( -1.5, 0.8 ) ),
+		] :
+			with self.subTest( matrix = matrix ) :
+				resample["matrix"].setValue( matrix )
+				self.assertImagesEqual( resample["out"], singlePass["out"], maxDifference = 0.0005 )
+
 	def testNearest( self ) :
 
 		reader = GafferImage.ImageReader()
@@ -323,6 +323,58 @@ class ResizeTest( GafferImageTest.ImageTestCase ) :
 
 						self.assertEqual( r["out"]["dataWindow"].getValue(), r["out"]["format"].getValue().getDisplayWindow() )
 
+	def testPyramid( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 1024, 1024 ) )
+		ramp["startPosition"].setValue( imath.V2f( 0 ) )
+		ramp["endPosition"].setValue( imath.V2f( 1024 ) )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( ramp["out"] )
+
+		pyramidResize = GafferImage.Resize()
+		pyramidResize["in"].setInput( ramp["out"] )
+		pyramidResize["format"].setInput( resize["format"] )
+		pyramidResize["usePyramid"].setValue( True )
+
+		for size in [ 2000, 700, 300, 100, 37, 3 ] :
+
+			resize["format"].setValue( GafferImage.Format( size, size ) )
+			self.assertEqual( pyramidResize["out"]["format"].getValue(), resize["out"]["format"].getValue() )
+
+			# A ramp is unchanged by box filtering, so we expect the results
+			# to match closely, although not exactly.
+			self.assertImagesEqual( pyramidResize["out"], resize["out"], maxDifference = 0.01, ignoreDataWindow = True )
+
+			if size > 1024 :
+				# No pyramid is used for upscaling.
+				self.assertImagesEqual( pyramidResize["out"], resize["out"] )
+
+	def testPyramidIgnoresDeep( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "representativeDeepImage.exr" )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( reader["out"] )
+		resize["format"].setValue( GafferImage.Format( 20, 20 ) )
+
+		pyramidResize = GafferImage.Resize()
+		pyramidResize["in"].setInput( reader["out"] )
+		pyramidResize["format"].setInput( resize["format"] )
+		pyramidResize["usePyramid"].setValue( True )
+
+		self.assertImagesEqual( pyramidResize["out"], resize["out"] )
+
+	def testUsePyramidAffectsChannelData( self ) :
+
+		r = GafferImage.Resize()
+		cs = GafferTest.CapturingSlot( r.plugDirtiedSignal() )
+		r["usePyramid"].setValue( True )
+
+		self.assertTrue( r["out"]["channelData"] in set( c[0] for c in cs ) )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
 	def testSimplestUpscalePerf( self ) :
 		imageReader = GafferImage.ImageReader()
@@ -352,3 +404,20 @@ class ResizeTest( GafferImageTest.ImageTestCase ) :
 
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( r["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testPyramidDownscalePerf( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 8192, 8192 ) )
+		ramp["endPosition"].setValue( imath.V2f( 8192 ) )
+
+		r = GafferImage.Resize()
+		r["in"].setInput( ramp["out"] )
+		r["format"].setValue( GafferImage.Format( 400, 400 ) )
+		r["usePyramid"].setValue( True )
+
+		GafferImageTest.processTiles( ramp["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( r["out"] )
@@ -102,6 +102,7 @@ from .DeepHoldoutTest import DeepHoldoutTest
 from .DeepRecolorTest import DeepRecolorTest
 from .ContextSanitiserTest import ContextSanitiserTest
 from .SaturationTest import SaturationTest
+from .ColorProcessorTest import ColorProcessorTest
 from .FormatQueryTest import FormatQueryTest
 from .CreateViewsTest import CreateViewsTest
 from .SelectViewTest import SelectViewTest
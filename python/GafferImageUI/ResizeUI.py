@@ -160,6 +160,21 @@ Gaffer.Metadata.registerNode(
 
 		},
 
+		"usePyramid" : {
+
+			"description" :
+			"""
+			Speeds up large reductions in size by first box filtering the
+			input by a power of two, leaving the main filter to perform
+			only the remaining reduction. The box filtered levels are
+			computed lazily, one tile at a time, and are cached so they can
+			be reused. This gives slightly softer results than filtering
+			the input directly, and has no effect on deep images or when
+			increasing the size.
+			""",
+
+		},
+
 	}
 
 )
@@ -123,6 +123,79 @@ class InferenceTest( GafferTest.TestCase ) :
 		with self.assertRaisesRegex( Gaffer.ProcessException, "Invalid rank for input" ) :
 			inference["out"][0].getValue()
 
+	@unittest.skipIf( GafferTest.inCI() and sys.platform == "darwin", "Compute fails with virtualised device on macOS CI" )
+	def testTiled( self ) :
+
+		inference = GafferML.Inference()
+		inference["model"].setValue( pathlib.Path( __file__ ).parent / "models" / "addDynamic.onnx" )
+		inference.loadModel()
+
+		width, height = 70, 45
+		inference["in"][0].setValue(
+			GafferML.Tensor( IECore.FloatVectorData( [ float( i % 17 ) for i in range( 0, 3 * width * height ) ] ), [ 1, 3, height, width ] )
+		)
+		inference["in"][1].setValue(
+			GafferML.Tensor( IECore.FloatVectorData( [ float( i % 5 ) for i in range( 0, 3 * width * height ) ] ), [ 1, 3, height, width ] )
+		)
+
+		untiled = inference["out"][0].getValue()
+
+		inference["tiled"].setValue( True )
+		for tileSize, tileOverlap, tileBatchSize in [
+			( 16, 4, 3 ),
+			( 16, 0, 1 ),
+			( 30, 8, 100 ),
+			( 100, 8, 4 ),
+		] :
+			with self.subTest( tileSize = tileSize, tileOverlap = tileOverlap, tileBatchSize = tileBatchSize ) :
+
+				inference["tileSize"].setValue( tileSize )
+				inference["tileOverlap"].setValue( tileOverlap )
+				inference["tileBatchSize"].setValue( tileBatchSize )
+
+				tiled = inference["out"][0].getValue()
+				self.assertEqual( tiled.shape(), untiled.shape() )
+				for a, b in zip( tiled.asData(), untiled.asData() ) :
+					self.assertAlmostEqual( a, b, places = 4 )
+
+	@unittest.skipIf( GafferTest.inCI() and sys.platform == "darwin", "Compute fails with virtualised device on macOS CI" )
+	def testTileOverlapMustBeLessThanTileSize( self ) :
+
+		inference = GafferML.Inference()
+		inference["model"].setValue( pathlib.Path( __file__ ).parent / "models" / "addDynamic.onnx" )
+		inference.loadModel()
+		inference["tiled"].setValue( True )
+
+		width, height = 70, 45
+		for i in range( 0, 2 ) :
+			inference["in"][i].setValue(
+				GafferML.Tensor( IECore.FloatVectorData( [ 1 ] * 3 * width * height ), [ 1, 3, height, width ] )
+			)
+
+		inference["tileSize"].setValue( 16 )
+		for tileOverlap in ( 16, 20 ) :
+			inference["tileOverlap"].setValue( tileOverlap )
+			with self.assertRaisesRegex( Gaffer.ProcessException, r"Tile overlap \({}\) must be less than tile size \(16\)".format( tileOverlap ) ) :
+				inference["out"][0].getValue()
+
+	@unittest.skipIf( GafferTest.inCI() and sys.platform == "darwin", "Compute fails with virtualised device on macOS CI" )
+	def testTiledRequiresImageInputs( self ) :
+
+		inference = GafferML.Inference()
+		inference["model"].setValue( pathlib.Path( __file__ ).parent / "models" / "add.onnx" )
+		inference.loadModel()
+		inference["tiled"].setValue( True )
+
+		inference["in"][0].setValue(
+			GafferML.Tensor( IECore.FloatVectorData( [ 1 ] * 60 ), [ 3, 4, 5 ] )
+		)
+		inference["in"][1].setValue(
+			GafferML.Tensor( IECore.FloatVectorData( [ 2 ] * 60 ), [ 3, 4, 5 ] )
+		)
+
+		with self.assertRaisesRegex( Gaffer.ProcessException, "Tiled inference requires" ) :
+			inference["out"][0].getValue()
+
 	def testModelSearchPaths( self ) :
 
 		node = GafferML.Inference()
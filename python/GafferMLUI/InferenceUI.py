@@ -52,6 +52,8 @@ Gaffer.Metadata.registerNode(
 	"layout:customWidget:loadButton:accessory", True,
 	"layout:customWidget:loadButton:index", 1,
 
+	"layout:activator:tiledIsOn", lambda node : node["tiled"].getValue(),
+
 	plugs = {
 
 		"model" : {
@@ -108,6 +110,76 @@ Gaffer.Metadata.registerNode(
 
 		},
 
+		"tiled" : {
+
+			"description" :
+			"""
+			Splits large images into overlapping tiles which are processed
+			separately and then blended back together. This bounds the memory
+			used by the model, and allows several tiles to be processed in a
+			single run.
+
+			Inputs with a shape of the form `[ 1, ..., height, width ]`, such
+			as those created by ImageToTensor with `interleaveChannels` off,
+			are tiled. All other inputs are passed unchanged to every run.
+			Outputs must have the same width and height as the tiled inputs,
+			or be scaled by an integer factor.
+
+			> Note : Only models which process each pixel using a limited
+			> neighbourhood, such as denoising and upscaling models, can be
+			> tiled without changing the result.
+			""",
+
+			"nodule:type" : "",
+			"layout:section" : "Tiling",
+
+		},
+
+		"tileSize" : {
+
+			"description" :
+			"""
+			The width and height of each tile, in pixels.
+			""",
+
+			"nodule:type" : "",
+			"layout:section" : "Tiling",
+			"layout:activator" : "tiledIsOn",
+
+		},
+
+		"tileOverlap" : {
+
+			"description" :
+			"""
+			The minimum number of pixels by which neighbouring tiles overlap.
+			Results are blended smoothly across the overlap, so this should be
+			at least as large as the region of the input that each output pixel
+			depends on. Must be less than the tile size.
+			""",
+
+			"nodule:type" : "",
+			"layout:section" : "Tiling",
+			"layout:activator" : "tiledIsOn",
+
+		},
+
+		"tileBatchSize" : {
+
+			"description" :
+			"""
+			The maximum number of tiles processed by each run of the model.
+			Larger batches can make better use of the hardware, at the expense
+			of increased memory usage. The model must accept a variable batch
+			size for values other than 1.
+			""",
+
+			"nodule:type" : "",
+			"layout:section" : "Tiling",
+			"layout:activator" : "tiledIsOn",
+
+		},
+
 	}
 )
 
@@ -36,7 +36,12 @@
 
 import unittest
 
+import imath
+
+import IECore
+
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -74,3 +79,109 @@ class FilterTest( GafferSceneTest.SceneTestCase ) :
 		# will cause a failure if the filter leaks a context variable like
 		# `scene:path` into the evaluation of the scene globals.
 		attributes["out"].attributes( "/plane" )
+
+	def testCacheMatches( self ) :
+
+		sphere = GafferScene.Sphere()
+		cube = GafferScene.Cube()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( cube["out"] )
+
+		outerGroup = GafferScene.Group()
+		outerGroup["in"][0].setInput( group["out"] )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group/*/sphere", "/.../cube", "/group/group/notThere" ] ) )
+
+		isolate = GafferScene.Isolate()
+		isolate["in"].setInput( outerGroup["out"] )
+		isolate["filter"].setInput( pathFilter["out"] )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( outerGroup["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", 1 ) )
+
+		def matches( scene ) :
+
+			result = {}
+			def visit( path ) :
+				with Gaffer.Context() as c :
+					c["scene:path"] = GafferScene.ScenePlug.stringToPath( path )
+					result[path] = attributes["filter"].match( scene )
+				for childName in scene.childNames( path ) :
+					visit( path.rstrip( "/" ) + "/" + str( childName ) )
+
+			visit( "/" )
+			return result
+
+		def isolatedPaths() :
+
+			result = IECore.PathMatcher()
+			GafferScene.SceneAlgo.matchingPaths( IECore.PathMatcher( [ "/..." ] ), isolate["out"], result )
+			return result
+
+		def assertCachedMatchesUncached() :
+
+			pathFilter["cacheMatches"].setValue( False )
+			expectedMatches = matches( attributes["in"] )
+			expectedIsolatedPaths = isolatedPaths()
+
+			pathFilter["cacheMatches"].setValue( True )
+			self.assertEqual( matches( attributes["in"] ), expectedMatches )
+			self.assertEqual( isolatedPaths(), expectedIsolatedPaths )
+			self.assertSceneValid( attributes["out"] )
+
+		assertCachedMatchesUncached()
+
+		# Changing the filter must invalidate the cached matches.
+
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group/group/sphere" ] ) )
+		assertCachedMatchesUncached()
+
+		# As must changing the hierarchy of the input scene.
+
+		sphere["name"].setValue( "cube" )
+		assertCachedMatchesUncached()
+
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/.../cube" ] ) )
+		assertCachedMatchesUncached()
+
+	def testCacheMatchesAffects( self ) :
+
+		pathFilter = GafferScene.PathFilter()
+
+		cs = GafferTest.CapturingSlot( pathFilter.plugDirtiedSignal() )
+		pathFilter["cacheMatches"].setValue( True )
+		self.assertIn( pathFilter["out"], { x[0] for x in cs } )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testCacheMatchesPerformance( self ) :
+
+		# Deep hierarchy with many locations, and a filter containing
+		# many expensive `...` wildcards.
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 200 ) )
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/.../instances/.../*{0,2,4,6,8}" ] ) )
+		pathFilter["cacheMatches"].setValue( True )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( instancer["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", 1 ) )
+
+		GafferSceneTest.traverseScene( instancer["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( attributes["out"] )
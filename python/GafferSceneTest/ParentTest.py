@@ -678,6 +678,71 @@ class ParentTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( parent["out"].set( "balls" ).value, IECore.PathMatcher( [ "/a/sphere" ] ) )
 		self.assertEqual( parent["out"].set( "squareThings" ).value, IECore.PathMatcher( [ "/b/box" ] ) )
 
+	def testSetsWithManyParents( self ) :
+
+		cube = GafferScene.Cube()
+		cube["sets"].setValue( "things" )
+
+		collect = GafferScene.CollectScenes()
+		collect["in"].setInput( cube["out"] )
+		collect["rootNames"].setValue( IECore.StringVectorData( [ "root{}".format( i ) for i in range( 0, 500 ) ] ) )
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "things" )
+
+		filter = GafferScene.PathFilter()
+		filter["paths"].setValue( IECore.StringVectorData( [ "/root*[02468]/cube" ] ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( collect["out"] )
+		parent["children"][0].setInput( sphere["out"] )
+		parent["filter"].setInput( filter["out"] )
+
+		expected = IECore.PathMatcher()
+		for i in range( 0, 500 ) :
+			expected.addPath( "/root{}/cube".format( i ) )
+			if i % 2 == 0 :
+				expected.addPath( "/root{}/cube/sphere".format( i ) )
+
+		self.assertEqual( parent["out"].set( "things" ).value, expected )
+		self.assertSceneValid( parent["out"] )
+
+		# The input set must not have been modified by the merge.
+		self.assertEqual( len( parent["in"].set( "things" ).value.paths() ), 500 )
+
+		sphere["name"].setValue( "ball" )
+		self.assertEqual(
+			parent["out"].set( "things" ).value,
+			IECore.PathMatcher( [ p.replace( "/sphere", "/ball" ) for p in expected.paths() ] )
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformanceWithManyParents( self ) :
+
+		cube = GafferScene.Cube()
+		cube["sets"].setValue( "things" )
+
+		collect = GafferScene.CollectScenes()
+		collect["in"].setInput( cube["out"] )
+		collect["rootNames"].setValue( IECore.StringVectorData( [ "root{}".format( i ) for i in range( 0, 20000 ) ] ) )
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "things" )
+
+		filter = GafferScene.PathFilter()
+		filter["paths"].setValue( IECore.StringVectorData( [ "/*/cube" ] ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( collect["out"] )
+		parent["children"][0].setInput( sphere["out"] )
+		parent["filter"].setInput( filter["out"] )
+
+		parent["in"].set( "things" )
+		parent["__branches"].getValue()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			parent["out"].set( "things" )
+
 	def testDestination( self ) :
 
 		# /group
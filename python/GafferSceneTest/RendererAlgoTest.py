@@ -61,6 +61,41 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertEqual( [ s.radius() for s in sampledObject.samples ], [ 0.75, 1.25 ] )
 
+	def testObjectSamplesReuseMatchingHashes( self ) :
+
+		# Switch between two static spheres part way through the shutter,
+		# so that the samples either side of the switch have matching hashes.
+
+		sphere1 = GafferScene.Sphere()
+		sphere1["type"].setValue( sphere1.Type.Primitive )
+
+		sphere2 = GafferScene.Sphere()
+		sphere2["type"].setValue( sphere2.Type.Primitive )
+		sphere2["radius"].setValue( 2 )
+
+		switch = Gaffer.Switch()
+		switch.setup( GafferScene.ScenePlug() )
+		switch["in"][0].setInput( sphere1["out"] )
+		switch["in"][1].setInput( sphere2["out"] )
+
+		expression = Gaffer.Expression()
+		switch.addChild( expression )
+		expression.setExpression( 'parent["index"] = context.getFrame() >= 1.0' )
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			sampledObject = GafferScene.Private.RendererAlgo.objectSamples( switch["out"]["object"], [ 0.5, 0.75, 1.0, 1.5 ], _copy = False )
+			sampledTransform = GafferScene.Private.RendererAlgo.transformSamples( switch["out"]["transform"], [ 0.5, 0.75, 1.0, 1.5 ] )
+
+		self.assertEqual( [ s.radius() for s in sampledObject.samples ], [ 1.0, 1.0, 2.0, 2.0 ] )
+		self.assertEqual( sampledObject.sampleTimes, [ 0.5, 0.75, 1.0, 1.5 ] )
+		self.assertTrue( sampledObject.samples[1].isSame( sampledObject.samples[0] ) )
+		self.assertFalse( sampledObject.samples[2].isSame( sampledObject.samples[1] ) )
+		self.assertTrue( sampledObject.samples[3].isSame( sampledObject.samples[2] ) )
+
+		# Transforms are identical at every sample, so collapse to one.
+		self.assertEqual( sampledTransform.samples, [ imath.M44f() ] )
+
 	def testNonInterpolableObjectSamples( self ) :
 
 		frame = GafferTest.FrameNode()
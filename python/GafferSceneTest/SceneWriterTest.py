@@ -515,3 +515,53 @@ class SceneWriterTest( GafferSceneTest.SceneTestCase ) :
 
 		scene = IECoreScene.SceneCache( writer["fileName"].getValue(), IECore.IndexedIO.Read )
 		self.assertEqual( scene.readAttribute( "gaffer:globals", 1 ), writer["in"].globals() )
+
+	def testStaticValuesWrittenOnce( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["sphere"]["out"] )
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["group"]["transform"]["translate"]["x"] = context.getFrame()' )
+
+		script["writer"] = GafferScene.SceneWriter()
+		script["writer"]["in"].setInput( script["group"]["out"] )
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+		script["writer"]["task"].executeSequence( range( 1, 6 ) )
+
+		scene = IECoreScene.SceneCache( str( script["writer"]["fileName"].getValue() ), IECore.IndexedIO.Read )
+		group = scene.child( "group" )
+		sphere = group.child( "sphere" )
+
+		self.assertEqual( group.numTransformSamples(), 5 )
+		self.assertEqual( sphere.numTransformSamples(), 1 )
+		self.assertEqual( sphere.numObjectSamples(), 1 )
+
+	def testChangeAfterStaticFrames( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["sphere"]["transform"]["translate"]["x"] = 0 if context.getFrame() <= 3 else context.getFrame()' )
+
+		script["writer"] = GafferScene.SceneWriter()
+		script["writer"]["in"].setInput( script["sphere"]["out"] )
+
+		for extension in self.__extensions :
+			with self.subTest( extension = extension ) :
+
+				script["writer"]["fileName"].setValue( self.temporaryDirectory() / ( "test" + extension ) )
+				script["writer"]["task"].executeSequence( range( 1, 6 ) )
+
+				scene = IECoreScene.SceneInterface.create( str( script["writer"]["fileName"].getValue() ), IECore.IndexedIO.OpenMode.Read )
+				sphere = scene.child( "sphere" )
+
+				# The transform must be held until frame 3, rather than being
+				# interpolated all the way from frame 1 to frame 4.
+				for frame, x in [ ( 1, 0 ), ( 2.5, 0 ), ( 3, 0 ), ( 4, 4 ), ( 5, 5 ) ] :
+					self.assertTrue(
+						sphere.readTransformAsMatrix( frame / 24.0 ).equalWithAbsError( imath.M44d().translate( imath.V3d( x, 0, 0 ) ), 1e-6 ),
+						msg = "Frame {}".format( frame )
+					)
+
@@ -40,6 +40,7 @@ import functools
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -375,6 +376,59 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 					self.assertNotIn( h, hashes )
 					hashes.add( h )
 
+	def testRepeatedSubexpressions( self ) :
+
+		spheres = []
+		group = GafferScene.Group()
+		for name in "ABCD" :
+			sphere = GafferScene.Sphere()
+			sphere["name"].setValue( "sphere" + name )
+			sphere["sets"].setValue( "set" + name + " all" )
+			group["in"][len( spheres )].setInput( sphere["out"] )
+			spheres.append( sphere )
+
+		expression = "( (setA setB) - setC ) | ( (setA setB) & setD ) | ( (setA setB) in all )"
+		self.assertCorrectEvaluation( group["out"], expression, [ "/group/sphereA", "/group/sphereB" ] )
+
+		# Results must be updated when the sets change.
+
+		spheres[2]["sets"].setValue( "setC setD all" )
+		spheres[3]["sets"].setValue( "setA all" )
+		self.assertCorrectEvaluation( group["out"], expression, [ "/group/sphereA", "/group/sphereB", "/group/sphereD" ] )
+
+		spheres[3]["sets"].setValue( "all" )
+		self.assertCorrectEvaluation( group["out"], expression, [ "/group/sphereA", "/group/sphereB" ] )
+
+		# Including sets matched by wildcards.
+
+		self.assertCorrectEvaluation( group["out"], "set* - setA", [ "/group/sphereB", "/group/sphereC" ] )
+		spheres[3]["sets"].setValue( "setE all" )
+		self.assertCorrectEvaluation( group["out"], "set* - setA", [ "/group/sphereB", "/group/sphereC", "/group/sphereD" ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyExpressionsPerformance( self ) :
+
+		group = GafferScene.Group()
+		for i in range( 0, 50 ) :
+			light = GafferSceneTest.TestLight()
+			light["name"].setValue( "light{}".format( i ) )
+			light["sets"].setValue( "lightSet{} lightGroup{}".format( i, i % 5 ) )
+			group["in"][i].setInput( light["out"] )
+
+		expressions = [
+			"(lightGroup{} | lightSet{}) - lightSet{}".format( i % 5, i % 50, ( i * 7 ) % 50 )
+			for i in range( 0, 2000 )
+		]
+
+		# Compute the sets up front, so we measure only the evaluation.
+		for setName in group["out"].setNames() :
+			group["out"].set( setName )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 5 ) :
+				for expression in expressions :
+					GafferScene.SetAlgo.evaluateSetExpression( expression, group["out"] )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
@@ -72,7 +72,25 @@ Gaffer.Metadata.registerNode(
 
 			"plugValueWidget:type" : "",
 
-		}
+		},
+
+		"cacheMatches" : {
+
+			"description" :
+			"""
+			Evaluates the filter for the entire input scene in a single
+			parallel traversal, and caches the results. Each location is
+			then a fast lookup, which can improve performance when an
+			expensive filter is shared by many nodes. The traversal is
+			repeated whenever the filter or the input scene changes, so
+			this is best used with filters which are costly to evaluate,
+			and with scenes which are not excessively large.
+			""",
+
+			"nodule:type" : "",
+			"layout:index" : -1,
+
+		},
 
 	}
 
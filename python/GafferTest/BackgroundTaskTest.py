@@ -35,6 +35,7 @@
 ##########################################################################
 
 import functools
+import queue
 import threading
 import time
 
@@ -254,3 +255,93 @@ class BackgroundTaskTest( GafferTest.TestCase ) :
 		# GIL while doing that then it'll never be able to
 		# check for cancellation, and we'll deadlock.
 		del task
+
+	def testPriority( self ) :
+
+		for priority in Gaffer.BackgroundTask.Priority.values.values() :
+			t = Gaffer.BackgroundTask( None, lambda canceller : None, priority )
+			self.assertEqual( t.priority(), priority )
+			self.assertTrue( t.waitFor( 10 ) )
+			self.assertEqual( t.status(), t.Status.Completed )
+
+		t = Gaffer.BackgroundTask( None, lambda canceller : None )
+		self.assertEqual( t.priority(), t.Priority.Normal )
+
+	def testHighPriorityDoesNotCancelLowPriority( self ) :
+
+		lowStarted = threading.Event()
+		lowFinish = threading.Event()
+
+		def low( canceller ) :
+
+			lowStarted.set()
+			while not lowFinish.is_set() :
+				IECore.Canceller.check( canceller )
+				time.sleep( 0.001 )
+
+		lowTask = Gaffer.BackgroundTask( None, low, Gaffer.BackgroundTask.Priority.Low )
+		self.assertTrue( lowStarted.wait( timeout = 10 ) )
+
+		# Priorities only affect which tasks are given threads. Running
+		# tasks are never interrupted by tasks of higher priority.
+
+		highTask = Gaffer.BackgroundTask( None, lambda canceller : None, Gaffer.BackgroundTask.Priority.High )
+		self.assertTrue( highTask.waitFor( 10 ) )
+		self.assertEqual( highTask.status(), highTask.Status.Completed )
+		self.assertEqual( lowTask.status(), lowTask.Status.Running )
+
+		lowFinish.set()
+		self.assertTrue( lowTask.waitFor( 10 ) )
+		self.assertEqual( lowTask.status(), lowTask.Status.Completed )
+
+	def testHighPriorityIsGivenThreadsFirst( self ) :
+
+		# Occupy every thread with tasks which block until we release them.
+
+		release = threading.Semaphore( 0 )
+		started = queue.Queue()
+
+		def blocker( canceller ) :
+
+			started.put( True )
+			while not release.acquire( timeout = 0.01 ) :
+				IECore.Canceller.check( canceller )
+
+		blockers = []
+		while True :
+			self.assertLess( len( blockers ), 1024 )
+			blockers.append( Gaffer.BackgroundTask( None, blocker ) )
+			try :
+				started.get( timeout = 1 )
+			except queue.Empty :
+				# No thread was available to start the last blocker,
+				# so all threads are now occupied. We don't need the
+				# last blocker to run at all.
+				blockers.pop().cancel()
+				break
+
+		# Start a Low priority task, followed by a High priority one. Neither
+		# can run yet.
+
+		order = []
+		lowTask = Gaffer.BackgroundTask( None, lambda canceller : order.append( "low" ), Gaffer.BackgroundTask.Priority.Low )
+		highTask = Gaffer.BackgroundTask( None, lambda canceller : order.append( "high" ), Gaffer.BackgroundTask.Priority.High )
+
+		self.assertFalse( highTask.waitFor( 0.1 ) )
+		self.assertEqual( order, [] )
+
+		# Free a single thread. It must be given to the High priority task,
+		# even though the Low priority task was started first.
+
+		release.release()
+		self.assertTrue( highTask.waitFor( 10 ) )
+		self.assertEqual( order[0], "high" )
+
+		# Free the remaining threads, so the Low priority task can run.
+
+		for i in range( 1, len( blockers ) ) :
+			release.release()
+		for t in blockers :
+			self.assertTrue( t.waitFor( 10 ) )
+		self.assertTrue( lowTask.waitFor( 10 ) )
+		self.assertEqual( order, [ "high", "low" ] )
@@ -812,6 +812,10 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testCopyEditableScope()
 
+	def testEditableScopeReuse( self ) :
+
+		GafferTest.testEditableScopeReuse()
+
 	def testSubstituteInternedString( self ) :
 
 		c = Gaffer.Context()
@@ -227,3 +227,9 @@ class LRUCacheTest( GafferTest.TestCase ) :
 		for policy in [ "serial", "parallel", "taskParallel" ] :
 			with self.subTest( policy = policy ) :
 				GafferTest.testLRUCacheSetIfUncached( policy )
+
+	def testRetention( self ) :
+
+		for policy in [ "serial", "parallel", "taskParallel" ] :
+			with self.subTest( policy = policy ) :
+				GafferTest.testLRUCacheRetention( policy )
@@ -0,0 +1,139 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import json
+import unittest
+
+import Gaffer
+import GafferTest
+
+class TraceMonitorTest( GafferTest.TestCase ) :
+
+	def testConstruction( self ) :
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor = Gaffer.TraceMonitor( str( fileName ) )
+		self.assertEqual( monitor.fileName(), str( fileName ) )
+		del monitor
+
+		with open( fileName ) as f :
+			self.assertEqual( json.load( f ), [] )
+
+	def testBadFileName( self ) :
+
+		with self.assertRaisesRegex( Exception, "Unable to open file" ) :
+			Gaffer.TraceMonitor( str( self.temporaryDirectory() / "nonexistent" / "trace.json" ) )
+
+	def testMonitoring( self ) :
+
+		fileName = self.temporaryDirectory() / "trace.json"
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		# Small buffer size, to exercise the case where threads
+		# must wait for the writer to catch up.
+		monitor = Gaffer.TraceMonitor( str( fileName ), bufferSize = 16 )
+		performanceMonitor = Gaffer.PerformanceMonitor()
+		with monitor, performanceMonitor :
+			GafferTest.parallelGetValue( random["outFloat"], 10000, "test" )
+		del monitor
+
+		with open( fileName ) as f :
+			events = json.load( f )
+
+		statistics = performanceMonitor.plugStatistics( random["outFloat"] )
+
+		beginEvents = [ e for e in events if e["ph"] == "B" ]
+		endEvents = [ e for e in events if e["ph"] == "E" ]
+
+		self.assertEqual( len( beginEvents ), statistics.hashCount + statistics.computeCount )
+		self.assertEqual( len( endEvents ), len( beginEvents ) )
+		self.assertEqual( { e["name"] for e in beginEvents }, { random["outFloat"].fullName() } )
+		self.assertEqual(
+			sum( 1 for e in beginEvents if e["cat"] == "computeNode:compute" ),
+			statistics.computeCount
+		)
+
+		# Begin and end events must be properly nested on each thread,
+		# with timestamps increasing monotonically.
+
+		threadNames = { e["tid"] for e in events if e["ph"] == "M" }
+		for tid in { e["tid"] for e in beginEvents } :
+			self.assertIn( tid, threadNames )
+			depth = 0
+			time = 0
+			for e in [ e for e in events if e["tid"] == tid and e["ph"] != "M" ] :
+				self.assertGreaterEqual( e["ts"], time )
+				time = e["ts"]
+				depth += 1 if e["ph"] == "B" else -1
+				self.assertGreaterEqual( depth, 0 )
+			self.assertEqual( depth, 0 )
+
+	def testFlush( self ) :
+
+		fileName = self.temporaryDirectory() / "trace.json"
+
+		random = Gaffer.Random()
+		monitor = Gaffer.TraceMonitor( str( fileName ) )
+		with monitor :
+			random["outFloat"].getValue()
+
+		monitor.flush()
+
+		# File is incomplete until the monitor is destroyed,
+		# but should already contain the events.
+		with open( fileName ) as f :
+			events = json.loads( f.read() + "]" )
+		self.assertEqual( { e["name"] for e in events if e["ph"] == "B" }, { random["outFloat"].fullName() } )
+
+	def testProcessMask( self ) :
+
+		fileName = self.temporaryDirectory() / "trace.json"
+
+		random = Gaffer.Random()
+		monitor = Gaffer.TraceMonitor( str( fileName ), processMask = { "computeNode:compute" } )
+		with monitor :
+			random["outFloat"].getValue()
+		del monitor
+
+		with open( fileName ) as f :
+			events = json.load( f )
+
+		self.assertEqual( [ e["cat"] for e in events if e["ph"] == "B" ], [ "computeNode:compute" ] )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -1047,14 +1047,456 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	class PersistentNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name = "PersistentNode" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["in"] = Gaffer.StringPlug()
+			self["out"] = Gaffer.ObjectPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.NullObject.defaultNullObject() )
+
+			self.numComputes = 0
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, output, context, h ) :
+
+			Gaffer.ComputeNode.hash( self, output, context, h )
+			if output == self["out"] :
+				self["in"].hash( h )
+
+		def compute( self, output, context ) :
+
+			if output == self["out"] :
+				self.numComputes += 1
+				output.setValue( IECore.StringData( self["in"].getValue() ) )
+
+		def computeCachePolicy( self, output ) :
+
+			return Gaffer.ValuePlug.CachePolicy.Persistent
+
+	IECore.registerRunTimeTyped( PersistentNode )
+
+	def testPersistentCache( self ) :
+
+		node = self.PersistentNode()
+		node["in"].setValue( "a" )
+
+		# Persistent cache is disabled by default, so we compute
+		# again each time the memory cache is cleared.
+
+		self.assertEqual( Gaffer.ValuePlug.getPersistentCacheDirectory(), "" )
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "a" ) )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "a" ) )
+		self.assertEqual( node.numComputes, 2 )
+
+		# When enabled, values are retrieved from disk instead.
+
+		directory = self.temporaryDirectory() / "persistentCache"
+		Gaffer.ValuePlug.setPersistentCacheDirectory( directory.as_posix() )
+		self.assertEqual( Gaffer.ValuePlug.getPersistentCacheDirectory(), directory.as_posix() )
+		self.assertTrue( directory.is_dir() )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "a" ) )
+		self.assertEqual( node.numComputes, 3 )
+		self.assertEqual( len( list( directory.glob( "*/*.cob" ) ) ), 1 )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "a" ) )
+		self.assertEqual( node.numComputes, 3 )
+
+		# New values are stored as they are computed.
+
+		node["in"].setValue( "b" )
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "b" ) )
+		self.assertEqual( node.numComputes, 4 )
+		self.assertEqual( len( list( directory.glob( "*/*.cob" ) ) ), 2 )
+
+		# A fresh directory scan finds the existing files.
+
+		usage = Gaffer.ValuePlug.persistentCacheUsage()
+		Gaffer.ValuePlug.setPersistentCacheDirectory( "" )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( directory.as_posix() )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), usage )
+
+		# Reducing the size limit evicts files.
+
+		Gaffer.ValuePlug.setPersistentCacheSizeLimit( 0 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		self.assertEqual( len( list( directory.glob( "*/*.cob" ) ) ), 0 )
+		Gaffer.ValuePlug.setPersistentCacheSizeLimit( self.__originalPersistentCacheSizeLimit )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "b" ) )
+		self.assertEqual( node.numComputes, 5 )
+
+		# And so does clearing.
+
+		Gaffer.ValuePlug.clearPersistentCache()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		self.assertEqual( len( list( directory.glob( "*/*.cob" ) ) ), 0 )
+
+	class CostNode( Gaffer.ComputeNode ) :
+
+		# Computes a result with a known minimum compute duration and
+		# a known memory usage, so that the retention given to it in
+		# `CostWeighted` mode is predictable.
+
+		def __init__( self, name = "CostNode", delay = 0.0, result = IECore.NullObject.defaultNullObject() ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["in"] = Gaffer.IntPlug()
+			self["out"] = Gaffer.ObjectPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.NullObject.defaultNullObject() )
+
+			self.__delay = delay
+			self.__result = result
+			self.numComputes = 0
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, output, context, h ) :
+
+			Gaffer.ComputeNode.hash( self, output, context, h )
+			if output == self["out"] :
+				self["in"].hash( h )
+
+		def compute( self, output, context ) :
+
+			if output == self["out"] :
+				self.numComputes += 1
+				if self.__delay :
+					time.sleep( self.__delay )
+				output.setValue( self.__result, _copy = False )
+
+	IECore.registerRunTimeTyped( CostNode )
+
+	def testCacheEvictionMode( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionMode(), Gaffer.ValuePlug.CacheEvictionMode.LeastRecentlyUsed )
+
+		# An expensive compute with a tiny result, and a cheap compute with
+		# a large result. Retention is the log of nanoseconds per byte, capped
+		# at 16. A sleep is a lower bound on duration, so the expensive result
+		# always gets the maximum retention. The cheap compute just returns an
+		# existing 1Mb object, which takes well under a nanosecond per byte,
+		# so it gets a retention of 0.
+
+		expensiveResult = IECore.IntData( 1 )
+		expensive = self.CostNode( delay = 0.01, result = expensiveResult )
+		self.assertGreater( 0.01 * 1e9 / expensiveResult.memoryUsage(), 2 ** 16 )
+
+		cheapResult = IECore.StringData( "x" * 1024 * 1024 )
+		cheap = self.CostNode( result = cheapResult )
+
+		# The cache is big enough for 10 of the cheap results, and each
+		# run makes 50 of them, so the expensive result is visited by the
+		# eviction sweep far fewer than 16 times.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( cheapResult.memoryUsage() * 10 )
+
+		def evaluate() :
+
+			Gaffer.ValuePlug.clearCache()
+			Gaffer.ValuePlug.clearHashCache()
+			expensive.numComputes = 0
+			expensive["out"].getValue()
+			for i in range( 0, 50 ) :
+				cheap["in"].setValue( i )
+				cheap["out"].getValue()
+			expensive["out"].getValue()
+			return expensive.numComputes
+
+		# With LRU eviction, the expensive result is evicted and
+		# computed again.
+
+		self.assertEqual( evaluate(), 2 )
+
+		# With cost-weighted eviction and the same workload it is retained,
+		# even though it was used less recently than the cheap results.
+
+		Gaffer.ValuePlug.setCacheEvictionMode( Gaffer.ValuePlug.CacheEvictionMode.CostWeighted )
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionMode(), Gaffer.ValuePlug.CacheEvictionMode.CostWeighted )
+
+		self.assertEqual( evaluate(), 1 )
+
+	def testCacheStatistics( self ) :
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		Gaffer.ValuePlug.resetCacheStatistics()
+
+		def assertStatistics( statistics, hits, misses, evictions ) :
+
+			self.assertEqual( statistics.hits, hits )
+			self.assertEqual( statistics.misses, misses )
+			self.assertEqual( statistics.collaborations, 0 )
+			self.assertEqual( statistics.evictions, evictions )
+
+		assertStatistics( Gaffer.ValuePlug.computeCacheStatistics(), hits = 0, misses = 0, evictions = 0 )
+		assertStatistics( Gaffer.ValuePlug.hashCacheStatistics(), hits = 0, misses = 0, evictions = 0 )
+
+		self.assertEqual( node["sum"].getValue(), 1 )
+		assertStatistics( Gaffer.ValuePlug.computeCacheStatistics(), hits = 0, misses = 1, evictions = 0 )
+		assertStatistics( Gaffer.ValuePlug.hashCacheStatistics(), hits = 0, misses = 1, evictions = 0 )
+
+		self.assertEqual( node["sum"].getValue(), 1 )
+		assertStatistics( Gaffer.ValuePlug.computeCacheStatistics(), hits = 1, misses = 1, evictions = 0 )
+		assertStatistics( Gaffer.ValuePlug.hashCacheStatistics(), hits = 1, misses = 1, evictions = 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		assertStatistics( Gaffer.ValuePlug.computeCacheStatistics(), hits = 1, misses = 1, evictions = 1 )
+
+		Gaffer.ValuePlug.resetCacheStatistics()
+		assertStatistics( Gaffer.ValuePlug.computeCacheStatistics(), hits = 0, misses = 0, evictions = 0 )
+		assertStatistics( Gaffer.ValuePlug.hashCacheStatistics(), hits = 0, misses = 0, evictions = 0 )
+
+	def testCacheUsageTracking( self ) :
+
+		self.assertFalse( Gaffer.ValuePlug.getCacheUsageTrackingEnabled() )
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+
+		Gaffer.ValuePlug.clearCache()
+		node["sum"].getValue()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsageByNodeType(), {} )
+
+		Gaffer.ValuePlug.setCacheUsageTrackingEnabled( True )
+		self.assertTrue( Gaffer.ValuePlug.getCacheUsageTrackingEnabled() )
+
+		# Entries added before tracking was enabled are not accounted for.
+
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsageByNodeType(), {} )
+
+		for i in range( 1, 11 ) :
+			node["op2"].setValue( i )
+			node["sum"].getValue()
+
+		usage = Gaffer.ValuePlug.cacheMemoryUsageByNodeType()
+		self.assertEqual( list( usage.keys() ), [ ( "GafferTest::AddNode", "sum" ) ] )
+		self.assertEqual( usage[( "GafferTest::AddNode", "sum" )].entries, 10 )
+		self.assertEqual( usage[( "GafferTest::AddNode", "sum" )].bytes, 10 * IECore.IntData( 1 ).memoryUsage() )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsageByNodeType(), {} )
+
+		node["sum"].getValue()
+		self.assertEqual( len( Gaffer.ValuePlug.cacheMemoryUsageByNodeType() ), 1 )
+
+		Gaffer.ValuePlug.setCacheUsageTrackingEnabled( False )
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsageByNodeType(), {} )
+
+	def testSharedHashCache( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheScope(), Gaffer.ValuePlug.HashCacheScope.PerThread )
+		Gaffer.ValuePlug.setHashCacheScope( Gaffer.ValuePlug.HashCacheScope.Shared )
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheScope(), Gaffer.ValuePlug.HashCacheScope.Shared )
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+		Gaffer.ValuePlug.resetCacheStatistics()
+
+		h = node["sum"].hash()
+		self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 1 )
+		self.assertEqual( Gaffer.ValuePlug.hashCacheStatistics().misses, 1 )
+
+		self.assertEqual( node["sum"].hash(), h )
+		self.assertEqual( Gaffer.ValuePlug.hashCacheStatistics().hits, 1 )
+		self.assertEqual( Gaffer.ValuePlug.hashCacheStatistics().misses, 1 )
+
+		# Dirtying must invalidate the shared entry.
+
+		node["op2"].setValue( 1 )
+		self.assertNotEqual( node["sum"].hash(), h )
+		self.assertEqual( node["sum"].getValue(), 2 )
+
+		# Resizing must leave us with a working cache.
+
+		Gaffer.ValuePlug.setHashCacheSizeLimit( Gaffer.ValuePlug.getHashCacheSizeLimit() * 2 )
+		node["op2"].setValue( 2 )
+		self.assertEqual( node["sum"].getValue(), 3 )
+		self.assertEqual( node["sum"].hash(), node["sum"].hash() )
+
+		# As must switching back to per-thread caches.
+
+		Gaffer.ValuePlug.setHashCacheScope( Gaffer.ValuePlug.HashCacheScope.PerThread )
+		node["op2"].setValue( 3 )
+		self.assertEqual( node["sum"].getValue(), 4 )
+
+	def __hashCacheScopePerformance( self, scope ) :
+
+		Gaffer.ValuePlug.setHashCacheScope( scope )
+
+		# A deep chain of nodes, so that hashing the last node requires
+		# hashing all the others. This is analogous to a deep scene
+		# traversal, where every thread requires the hashes for the
+		# same ancestor locations.
+
+		nodes = [ GafferTest.AddNode() ]
+		for i in range( 0, 200 ) :
+			node = GafferTest.AddNode()
+			node["op1"].setInput( nodes[-1]["sum"] )
+			nodes.append( node )
+
+		nodes[-1]["sum"].getValue()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 100 ) :
+				Gaffer.ValuePlug.clearHashCache( now = True )
+				GafferTest.parallelGetValue( nodes[-1]["sum"], 10000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerThreadHashCachePerformance( self ) :
+
+		self.__hashCacheScopePerformance( Gaffer.ValuePlug.HashCacheScope.PerThread )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSharedHashCachePerformance( self ) :
+
+		self.__hashCacheScopePerformance( Gaffer.ValuePlug.HashCacheScope.Shared )
+
+	def testDirectEvaluationOverride( self ) :
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+		self.assertEqual( node.getDirectEvaluation(), Gaffer.ComputeNode.DirectEvaluation.Automatic )
+
+		# Always evaluating directly, so we compute on every call
+		# but never need the hash.
+
+		node.setDirectEvaluation( Gaffer.ComputeNode.DirectEvaluation.Always )
+		self.assertEqual( node.getDirectEvaluation(), Gaffer.ComputeNode.DirectEvaluation.Always )
+
+		monitor = Gaffer.PerformanceMonitor()
+		with monitor :
+			for i in range( 0, 10 ) :
+				self.assertEqual( node["sum"].getValue(), 1 )
+
+		self.assertEqual( monitor.plugStatistics( node["sum"] ).computeCount, 10 )
+		self.assertEqual( monitor.plugStatistics( node["sum"] ).hashCount, 0 )
+
+		# Never evaluating directly, even when profiling is enabled.
+
+		Gaffer.ValuePlug.setAutomaticDirectEvaluationEnabled( True )
+		self.assertTrue( Gaffer.ValuePlug.getAutomaticDirectEvaluationEnabled() )
+		node.setDirectEvaluation( Gaffer.ComputeNode.DirectEvaluation.Never )
+
+		monitor = Gaffer.PerformanceMonitor()
+		with monitor :
+			for i in range( 0, 2000 ) :
+				self.assertEqual( node["sum"].getValue(), 1 )
+
+		self.assertEqual( monitor.plugStatistics( node["sum"] ).computeCount, 1 )
+		self.assertFalse( Gaffer.ValuePlug.isDirectlyEvaluated( node["sum"] ) )
+
+	def testAutomaticDirectEvaluation( self ) :
+
+		Gaffer.ValuePlug.setAutomaticDirectEvaluationEnabled( True )
+
+		nodes = [ GafferTest.AddNode() ]
+		for i in range( 0, 10 ) :
+			node = GafferTest.AddNode()
+			node["op1"].setInput( nodes[-1]["sum"] )
+			node["op2"].setValue( 1 )
+			nodes.append( node )
+
+		# Whatever the profiling decides, and whenever it decides it,
+		# the results must be correct.
+
+		for i in range( 0, 2000 ) :
+			nodes[0]["op1"].setValue( i )
+			self.assertEqual( nodes[-1]["sum"].getValue(), i + 10 )
+			self.assertEqual( nodes[-1]["sum"].getValue(), i + 10 )
+
+	def testAutomaticDirectEvaluationOfUncacheablePlug( self ) :
+
+		Gaffer.ValuePlug.setAutomaticDirectEvaluationEnabled( True )
+
+		# Change the input before every evaluation, so that every evaluation
+		# is a cache miss. Caching then costs a hash and a compute per
+		# evaluation, whereas direct evaluation costs only the compute, so
+		# profiling is guaranteed to choose direct evaluation.
+
+		node = GafferTest.AddNode()
+		self.assertFalse( Gaffer.ValuePlug.isDirectlyEvaluated( node["sum"] ) )
+
+		for i in range( 0, 1024 ) :
+			node["op1"].setValue( i )
+			self.assertEqual( node["sum"].getValue(), i )
+			if Gaffer.ValuePlug.isDirectlyEvaluated( node["sum"] ) :
+				break
+
+		self.assertTrue( Gaffer.ValuePlug.isDirectlyEvaluated( node["sum"] ) )
+
+		# Plugs which are directly evaluated don't use the cache, so repeated
+		# evaluations each perform a compute.
+
+		node["op1"].setValue( 1000 )
+		node["op2"].setValue( 1 )
+		monitor = Gaffer.PerformanceMonitor()
+		with monitor :
+			self.assertEqual( node["sum"].getValue(), 1001 )
+			self.assertEqual( node["sum"].getValue(), 1001 )
+		self.assertEqual( monitor.plugStatistics( node["sum"] ).computeCount, 2 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testAutomaticDirectEvaluationPerformance( self ) :
+
+		Gaffer.ValuePlug.setAutomaticDirectEvaluationEnabled( True )
+
+		nodes = [ GafferTest.AddNode() ]
+		for i in range( 0, 100 ) :
+			node = GafferTest.AddNode()
+			node["op1"].setInput( nodes[-1]["sum"] )
+			nodes.append( node )
+
+		# Warm up, giving the profiling a chance to make its decisions.
+		GafferTest.parallelGetValue( nodes[-1]["sum"], 10000, "testVariable" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelGetValue( nodes[-1]["sum"], 1000000, "testVariable" )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
 
 		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalPersistentCacheSizeLimit = Gaffer.ValuePlug.getPersistentCacheSizeLimit()
+		self.__originalHashCacheSizeLimit = Gaffer.ValuePlug.getHashCacheSizeLimit()
 
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setPersistentCacheSizeLimit( self.__originalPersistentCacheSizeLimit )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( "" )
+		Gaffer.ValuePlug.setCacheEvictionMode( Gaffer.ValuePlug.CacheEvictionMode.LeastRecentlyUsed )
+		Gaffer.ValuePlug.setCacheUsageTrackingEnabled( False )
+		Gaffer.ValuePlug.setHashCacheScope( Gaffer.ValuePlug.HashCacheScope.PerThread )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( self.__originalHashCacheSizeLimit )
+		Gaffer.ValuePlug.setAutomaticDirectEvaluationEnabled( False )
@@ -150,6 +150,22 @@ ActiveTasks &activeTasks()
 	return a;
 }
 
+// Dedicated arenas for Low and High priority tasks, so that TBB
+// gives threads to High priority tasks first. We only ever enqueue
+// into these, so we don't reserve any slots for application threads.
+
+tbb::task_arena &lowPriorityArena()
+{
+	static tbb::task_arena a( tbb::task_arena::automatic, 0, tbb::task_arena::priority::low );
+	return a;
+}
+
+tbb::task_arena &highPriorityArena()
+{
+	static tbb::task_arena a( tbb::task_arena::automatic, 0, tbb::task_arena::priority::high );
+	return a;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -158,8 +174,8 @@ ActiveTasks &activeTasks()
 
 struct BackgroundTask::TaskData : public boost::noncopyable
 {
-	TaskData( Function *function )
-		:	function( function ), canceller( new Canceller ), status( Pending )
+	TaskData( Function *function, Priority priority )
+		:	function( function ), canceller( new Canceller ), status( Pending ), priority( priority )
 	{
 	}
 
@@ -169,10 +185,11 @@ struct BackgroundTask::TaskData : public boost::noncopyable
 	std::condition_variable conditionVariable;
 	Status status;
 	std::thread::id threadId; // Thread that is executing `function`, if any
+	const Priority priority;
 };
 
-BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
-	:	m_function( function ), m_taskData( std::make_shared<TaskData>( &m_function ) )
+BackgroundTask::BackgroundTask( const Plug *subject, const Function &function, Priority priority )
+	:	m_function( function ), m_taskData( std::make_shared<TaskData>( &m_function, priority ) )
 {
 	const ScriptNode *s = scriptNode( subject );
 	if( subject && !s )
@@ -182,65 +199,75 @@ BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
 
 	activeTasks().insert( ActiveTask{ this, s } );
 
-	// Enqueue task into current arena.
-	tbb::task_arena( tbb::task_arena::attach() ).enqueue(
-		[taskData = m_taskData] {
+	auto f = [taskData = m_taskData] {
 
-			// Early out if we were cancelled before the task
-			// even started.
-			std::unique_lock<std::mutex> lock( taskData->mutex );
-			if( taskData->status == Cancelled )
-			{
-				return;
-			}
+		// Early out if we were cancelled before the task
+		// even started.
+		std::unique_lock<std::mutex> lock( taskData->mutex );
+		if( taskData->status == Cancelled )
+		{
+			return;
+		}
 
-			// Otherwise do the work.
+		// Otherwise do the work.
 
-			taskData->status = Running;
-			taskData->threadId = std::this_thread::get_id();
-			lock.unlock();
+		taskData->status = Running;
+		taskData->threadId = std::this_thread::get_id();
+		lock.unlock();
 
-			// Reset thread state rather then inherit the random
-			// one that TBB task-stealing might present us with.
-			const ThreadState defaultThreadState;
-			ThreadState::Scope threadStateScope( defaultThreadState );
+		// Reset thread state rather then inherit the random
+		// one that TBB task-stealing might present us with.
+		const ThreadState defaultThreadState;
+		ThreadState::Scope threadStateScope( defaultThreadState );
 
-			Status status;
-			try
-			{
-				(*taskData->function)( *taskData->canceller );
-				status = Completed;
-			}
-			catch( const std::exception &e )
-			{
-				IECore::msg(
-					IECore::Msg::Error,
-					"BackgroundTask",
-					e.what()
-				);
-				status = Errored;
-			}
-			catch( const IECore::Cancelled & )
-			{
-				// No need to do anything
-				status = Cancelled;
-			}
-			catch( ... )
-			{
-				IECore::msg(
-					IECore::Msg::Error,
-					"BackgroundTask",
-					"Unknown error"
-				);
-				status = Errored;
-			}
-
-			lock.lock();
-			taskData->status = status;
-			taskData->threadId = std::thread::id();
-			taskData->conditionVariable.notify_one();
+		Status status;
+		try
+		{
+			(*taskData->function)( *taskData->canceller );
+			status = Completed;
 		}
-	);
+		catch( const std::exception &e )
+		{
+			IECore::msg(
+				IECore::Msg::Error,
+				"BackgroundTask",
+				e.what()
+			);
+			status = Errored;
+		}
+		catch( const IECore::Cancelled & )
+		{
+			// No need to do anything
+			status = Cancelled;
+		}
+		catch( ... )
+		{
+			IECore::msg(
+				IECore::Msg::Error,
+				"BackgroundTask",
+				"Unknown error"
+			);
+			status = Errored;
+		}
+
+		lock.lock();
+		taskData->status = status;
+		taskData->threadId = std::thread::id();
+		taskData->conditionVariable.notify_one();
+	};
+
+	switch( priority )
+	{
+		case Priority::Low :
+			lowPriorityArena().enqueue( f );
+			break;
+		case Priority::High :
+			highPriorityArena().enqueue( f );
+			break;
+		default :
+			// Enqueue task into current arena.
+			tbb::task_arena( tbb::task_arena::attach() ).enqueue( f );
+	}
 }
 
 BackgroundTask::~BackgroundTask()
@@ -327,6 +354,11 @@ BackgroundTask::Status BackgroundTask::status() const
 	return m_taskData->status;
 }
 
+BackgroundTask::Priority BackgroundTask::priority() const
+{
+	return m_taskData->priority;
+}
+
 void BackgroundTask::cancelAffectedTasks( const GraphComponent *actionSubject )
 {
 	const ActiveTasks &a = activeTasks();
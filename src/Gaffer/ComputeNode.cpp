@@ -44,7 +44,7 @@ using namespace Gaffer;
 GAFFER_NODE_DEFINE_TYPE( ComputeNode );
 
 ComputeNode::ComputeNode( const std::string &name )
-	:	DependencyNode( name )
+	:	DependencyNode( name ), m_directEvaluation( DirectEvaluation::Automatic )
 {
 }
 
@@ -52,6 +52,16 @@ ComputeNode::~ComputeNode()
 {
 }
 
+void ComputeNode::setDirectEvaluation( DirectEvaluation directEvaluation )
+{
+	m_directEvaluation = directEvaluation;
+}
+
+ComputeNode::DirectEvaluation ComputeNode::getDirectEvaluation() const
+{
+	return m_directEvaluation.load( std::memory_order_relaxed );
+}
+
 void ComputeNode::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
 {
 	// Hash in the TypeId for this node - this does two things.
@@ -43,6 +43,8 @@
 
 #include "boost/lexical_cast.hpp"
 
+#include <vector>
+
 // Headers needed to access environment - these differ
 // between OS X and Linux.
 #ifdef __APPLE__
@@ -338,8 +340,8 @@ void Context::remove( const IECore::InternedString &name )
 	Map::iterator it = m_map.find( name );
 	if( it != m_map.end() )
 	{
+		updateHash( it->second.hash(), MurmurHash() );
 		m_map.erase( it );
-		m_hashValid = false;
 		if( m_changedSignal )
 		{
 			(*m_changedSignal)( this, name );
@@ -358,8 +360,8 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 	{
 		if( StringAlgo::matchMultiple( it->first, pattern ) )
 		{
+			updateHash( it->second.hash(), MurmurHash() );
 			it = m_map.erase( it );
-			m_hashValid = false;
 			if( m_changedSignal )
 			{
 				(*m_changedSignal)( this, it->first );
@@ -480,20 +482,74 @@ Context::Scope::~Scope()
 {
 }
 
+namespace
+{
+
+// EditableScopes are rarely nested more than a few deep on any one
+// thread, so we don't need to retain many contexts for reuse.
+const size_t g_maxPooledContexts = 8;
+thread_local std::vector<ContextPtr> g_contextPool;
+
+} // namespace
+
 Context::EditableScope::EditableScope( const Context *context )
-	:	m_context( new Context( *context, CopyMode::NonOwning ) )
+	:	m_context( acquireContext( context ) )
 {
 	m_threadState->m_context = m_context.get();
 }
 
 Context::EditableScope::EditableScope( const ThreadState &threadState )
-	:	ThreadState::Scope( threadState ), m_context( new Context( *threadState.m_context, CopyMode::NonOwning ) )
+	:	ThreadState::Scope( threadState ), m_context( acquireContext( threadState.m_context ) )
 {
 	m_threadState->m_context = m_context.get();
 }
 
 Context::EditableScope::~EditableScope()
 {
+	releaseContext();
+}
+
+Context::Ptr Context::EditableScope::acquireContext( const Context *context )
+{
+	std::vector<Ptr> &pool = g_contextPool;
+	if( pool.empty() )
+	{
+		return new Context( *context, CopyMode::NonOwning );
+	}
+
+	Ptr result = std::move( pool.back() );
+	pool.pop_back();
+
+	// Equivalent to the NonOwning copy constructor, but assigning
+	// to the existing map reuses its storage, so we don't need to
+	// allocate unless `context` has more variables than any context
+	// previously recycled via this pool.
+	result->m_map.reserve( context->m_map.size() + 1 );
+	result->m_map = context->m_map;
+	result->m_hash = context->m_hash;
+	result->m_hashValid = context->m_hashValid;
+	result->m_canceller = context->m_canceller;
+	return result;
+}
+
+void Context::EditableScope::releaseContext()
+{
+	std::vector<Ptr> &pool = g_contextPool;
+	if( m_context->refCount() != 1 || pool.size() >= g_maxPooledContexts )
+	{
+		// Either someone has taken a reference to our context (so we
+		// can't reuse it), or the pool is full.
+		return;
+	}
+
+	// Release any data we own now, rather than keep it alive until
+	// the context is next used.
+	m_context->m_allocMap.clear();
+	m_context->m_cancellerOwner = nullptr;
+	delete m_context->m_changedSignal;
+	m_context->m_changedSignal = nullptr;
+
+	pool.push_back( std::move( m_context ) );
 }
 
 void Context::EditableScope::setCanceller( const IECore::Canceller *canceller )
@@ -113,7 +113,7 @@ bool ParallelAlgo::canCallOnUIThread()
 	return handlers->size();
 }
 
-GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread( const Plug *subject, BackgroundFunction function )
+GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread( const Plug *subject, BackgroundFunction function, BackgroundTask::Priority priority )
 {
 	ContextPtr backgroundContext = new Context( *Context::current() );
 	Monitor::MonitorSet backgroundMonitors = Monitor::current();
@@ -130,7 +130,9 @@ GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread(
 
 			function();
 
-		}
+		},
+
+		priority
 
 	);
 }
@@ -40,6 +40,9 @@
 
 #include "Gaffer/SetExpressionAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/ThreadState.h"
+
 #include "IECore/MessageHandler.h"
 #include "IECore/StringAlgo.h"
 
@@ -53,8 +56,14 @@
 #include "boost/variant/apply_visitor.hpp"
 #include "boost/variant/recursive_variant.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
 #include "fmt/format.h"
 
+#include <map>
+#include <memory>
 #include <optional>
 #include <set>
 
@@ -709,8 +718,12 @@ struct AstEvaluator
 	{
 		PathMatcher left = boost::apply_visitor( *this, expr.left );
 		PathMatcher right = boost::apply_visitor( *this, expr.right );
+		return evaluateOperation( left, expr.op, right );
+	}
 
-		switch( expr.op )
+	result_type evaluateOperation( const PathMatcher &left, Op op, const PathMatcher &right ) const
+	{
+		switch( op )
 		{
 			case Union :
 			{
@@ -1009,6 +1022,228 @@ ExpressionAst removeExpression( const ExpressionAst &ast, const ExpressionAst &r
 	return simplifyExpression( filteredAst );
 }
 
+// Compiled expressions
+// --------------------
+//
+// Parsing is relatively expensive, and the same expressions tend to be
+// evaluated many times (by SetFilters, light linking and so on). So we cache
+// the parsed AST for each expression, along with an evaluation plan. The plan
+// is a flattened form of the AST, with duplicate subexpressions merged, and
+// with operations grouped into levels which can be evaluated in parallel.
+
+struct PlanNode
+{
+	enum class Type
+	{
+		Nil,
+		SetName,
+		ObjectName,
+		Operation
+	};
+
+	Type type = Type::Nil;
+	// Identifier for leaf nodes.
+	std::string identifier;
+	// Operation and operand indices for `Type::Operation`.
+	Op op = Union;
+	size_t left = 0;
+	size_t right = 0;
+};
+
+struct CompiledExpression
+{
+	ExpressionAst ast;
+	// Nodes are stored such that operands always precede the operations
+	// that use them. The last node is the root of the expression.
+	std::vector<PlanNode> nodes;
+	// Indices into `nodes`, grouped so that the nodes in each level depend
+	// only on nodes in previous levels.
+	std::vector<std::vector<size_t>> levels;
+};
+
+using ConstCompiledExpressionPtr = std::shared_ptr<const CompiledExpression>;
+
+struct PlanCompiler
+{
+	using result_type = size_t;
+
+	PlanCompiler( CompiledExpression &compiledExpression )
+		:	m_compiledExpression( compiledExpression )
+	{
+	}
+
+	size_t operator()( const Nil &nil )
+	{
+		PlanNode node;
+		return addNode( nil, node, 0 );
+	}
+
+	size_t operator()( const std::string &identifier )
+	{
+		PlanNode node;
+		node.identifier = identifier;
+		if( identifier[0] == '/' )
+		{
+			node.type = PlanNode::Type::ObjectName;
+		}
+		else
+		{
+			node.type = PlanNode::Type::SetName;
+		}
+		return addNode( identifier, node, 0 );
+	}
+
+	size_t operator()( const BinaryOp &expr )
+	{
+		auto it = m_indices.find( expr );
+		if( it != m_indices.end() )
+		{
+			return it->second;
+		}
+
+		PlanNode node;
+		node.type = PlanNode::Type::Operation;
+		node.op = expr.op;
+		node.left = boost::apply_visitor( *this, expr.left );
+		node.right = boost::apply_visitor( *this, expr.right );
+		const size_t level = std::max( m_levels[node.left], m_levels[node.right] ) + 1;
+		return addNode( expr, node, level );
+	}
+
+	private :
+
+		size_t addNode( const ExpressionAst &ast, const PlanNode &node, size_t level )
+		{
+			auto inserted = m_indices.insert( { ast, m_compiledExpression.nodes.size() } );
+			if( !inserted.second )
+			{
+				return inserted.first->second;
+			}
+
+			m_compiledExpression.nodes.push_back( node );
+			m_levels.push_back( level );
+			if( m_compiledExpression.levels.size() <= level )
+			{
+				m_compiledExpression.levels.resize( level + 1 );
+			}
+			m_compiledExpression.levels[level].push_back( inserted.first->second );
+			return inserted.first->second;
+		}
+
+		CompiledExpression &m_compiledExpression;
+		std::map<ExpressionAst, size_t> m_indices;
+		std::vector<size_t> m_levels;
+
+};
+
+using CompiledExpressionCache = IECorePreview::LRUCache<std::string, ConstCompiledExpressionPtr>;
+
+CompiledExpressionCache &compiledExpressionCache()
+{
+	static CompiledExpressionCache g_cache(
+		[] ( const std::string &setExpression, size_t &cost, const IECore::Canceller *canceller ) {
+			auto result = std::make_shared<CompiledExpression>();
+			expressionToAST( setExpression, result->ast );
+			if( !boost::get<Nil>( &result->ast ) )
+			{
+				PlanCompiler compiler( *result );
+				boost::apply_visitor( compiler, result->ast );
+			}
+			cost = 1;
+			return result;
+		},
+		10000
+	);
+	return g_cache;
+}
+
+ConstCompiledExpressionPtr compiledExpression( const std::string &setExpression )
+{
+	return compiledExpressionCache().get( setExpression );
+}
+
+class PlanEvaluator
+{
+
+	public :
+
+		PlanEvaluator( const CompiledExpression &compiledExpression, const SetExpressionAlgo::SetProvider &setProvider )
+			:	m_expression( compiledExpression ), m_setProvider( setProvider ), m_results( compiledExpression.nodes.size() )
+		{
+		}
+
+		PathMatcher evaluate()
+		{
+			const std::vector<PlanNode> &nodes = m_expression.nodes;
+			if( nodes.empty() )
+			{
+				return PathMatcher();
+			}
+
+			// Evaluate nodes a level at a time. Nodes within a level are
+			// independent, so are evaluated in parallel.
+
+			const ThreadState &threadState = ThreadState::current();
+			for( const auto &toEvaluate : m_expression.levels )
+			{
+				if( toEvaluate.size() == 1 )
+				{
+					evaluateNode( toEvaluate[0] );
+				}
+				else if( toEvaluate.size() > 1 )
+				{
+					// Isolate so that we can't steal outer tasks while waiting,
+					// since we may be called from within a compute.
+					tbb::this_task_arena::isolate(
+						[&] {
+							tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+							tbb::parallel_for(
+								tbb::blocked_range<size_t>( 0, toEvaluate.size(), 1 ),
+								[&] ( const tbb::blocked_range<size_t> &range ) {
+									ThreadState::Scope threadStateScope( threadState );
+									for( size_t i = range.begin(); i != range.end(); ++i )
+									{
+										evaluateNode( toEvaluate[i] );
+									}
+								},
+								taskGroupContext
+							);
+						}
+					);
+				}
+			}
+
+			return m_results.back();
+		}
+
+	private :
+
+		void evaluateNode( size_t index )
+		{
+			const PlanNode &node = m_expression.nodes[index];
+			PathMatcher &result = m_results[index];
+			switch( node.type )
+			{
+				case PlanNode::Type::Nil :
+					break;
+				case PlanNode::Type::ObjectName :
+				case PlanNode::Type::SetName :
+					result = AstEvaluator( m_setProvider )( node.identifier );
+					break;
+				case PlanNode::Type::Operation :
+					result = AstEvaluator( m_setProvider ).evaluateOperation(
+						m_results[node.left], node.op, m_results[node.right]
+					);
+					break;
+			}
+		}
+
+		const CompiledExpression &m_expression;
+		const SetExpressionAlgo::SetProvider &m_setProvider;
+		std::vector<PathMatcher> m_results;
+
+};
+
 } // namespace
 
 namespace Gaffer
@@ -1019,17 +1254,15 @@ namespace SetExpressionAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const SetProvider &setProvider )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
-	return boost::apply_visitor( AstEvaluator( setProvider ), ast );
+	ConstCompiledExpressionPtr expression = compiledExpression( setExpression );
+	return PlanEvaluator( *expression, setProvider ).evaluate();
 }
 
 void setExpressionHash( const std::string &setExpression, const SetProvider &setProvider, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstCompiledExpressionPtr expression = compiledExpression( setExpression );
 	AstHasher hasher = AstHasher( setProvider, h );
-	boost::apply_visitor( hasher, ast );
+	boost::apply_visitor( hasher, expression->ast );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const SetProvider &setProvider )
@@ -0,0 +1,260 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/TraceMonitor.h"
+
+#include "Gaffer/Plug.h"
+#include "Gaffer/Process.h"
+
+#include "IECore/Exception.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+
+using namespace Gaffer;
+
+namespace
+{
+
+// Interval at which the writer thread flushes events to file.
+const std::chrono::milliseconds g_writeInterval( 100 );
+
+size_t roundUpToPowerOfTwo( size_t n )
+{
+	size_t result = 1;
+	while( result < n )
+	{
+		result <<= 1;
+	}
+	return result;
+}
+
+std::string escape( const std::string &s )
+{
+	std::string result;
+	result.reserve( s.size() );
+	for( char c : s )
+	{
+		if( c == '"' || c == '\\' )
+		{
+			result.push_back( '\\' );
+		}
+		result.push_back( c );
+	}
+	return result;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// ThreadBuffer
+//////////////////////////////////////////////////////////////////////////
+
+TraceMonitor::ThreadBuffer::ThreadBuffer( size_t size, int id )
+	:	id( id ), events( size ), head( 0 ), tail( 0 ), described( false )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+// TraceMonitor
+//////////////////////////////////////////////////////////////////////////
+
+TraceMonitor::TraceMonitor( const std::string &fileName, const std::vector<IECore::InternedString> &processMask, size_t bufferSize )
+	:	m_fileName( fileName ), m_processMask( processMask ), m_bufferSize( roundUpToPowerOfTwo( std::max<size_t>( bufferSize, 2 ) ) ),
+		m_startTime( std::chrono::steady_clock::now() ), m_threadBuffers( nullptr ), m_stopping( false ), m_firstEvent( true )
+{
+	m_file.open( m_fileName );
+	if( !m_file.good() )
+	{
+		throw IECore::IOException( "Unable to open file \"" + m_fileName + "\"" );
+	}
+	m_file << "[\n";
+
+	m_writerThread = std::thread( [this] { writerLoop(); } );
+}
+
+TraceMonitor::~TraceMonitor()
+{
+	{
+		std::unique_lock<std::mutex> lock( m_writerMutex );
+		m_stopping = true;
+	}
+	m_writerCondition.notify_one();
+	m_writerThread.join();
+
+	std::unique_lock<std::mutex> lock( m_writerMutex );
+	writeEvents();
+	m_file << "\n]\n";
+}
+
+const std::string &TraceMonitor::fileName() const
+{
+	return m_fileName;
+}
+
+void TraceMonitor::flush()
+{
+	std::unique_lock<std::mutex> lock( m_writerMutex );
+	writeEvents();
+	m_file.flush();
+}
+
+void TraceMonitor::processStarted( const Process *process )
+{
+	pushEvent( process, /* begin = */ true );
+}
+
+void TraceMonitor::processFinished( const Process *process )
+{
+	pushEvent( process, /* begin = */ false );
+}
+
+void TraceMonitor::pushEvent( const Process *process, bool begin )
+{
+	if( std::find( m_processMask.begin(), m_processMask.end(), process->type() ) == m_processMask.end() )
+	{
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	ThreadBuffer &buffer = threadBuffer();
+
+	const size_t head = buffer.head.load( std::memory_order_relaxed );
+	while( head - buffer.tail.load( std::memory_order_acquire ) >= buffer.events.size() )
+	{
+		// Buffer is full. Wake the writer and wait for it to make room.
+		// We can't drop the event because that would leave begin and end
+		// events unpaired.
+		m_writerCondition.notify_one();
+		std::this_thread::yield();
+	}
+
+	Event &event = buffer.events[head & ( buffer.events.size() - 1 )];
+	event.time = std::chrono::duration_cast<std::chrono::nanoseconds>( now - m_startTime );
+	event.processType = process->type();
+	if( begin )
+	{
+		auto inserted = buffer.plugNames.try_emplace( process->plug() );
+		if( inserted.second )
+		{
+			inserted.first->second = process->plug()->fullName();
+		}
+		event.plugName = &inserted.first->second;
+		event.contextHash = process->context()->hash();
+	}
+	else
+	{
+		event.plugName = nullptr;
+	}
+
+	buffer.head.store( head + 1, std::memory_order_release );
+}
+
+TraceMonitor::ThreadBuffer &TraceMonitor::threadBuffer()
+{
+	ThreadBuffer *&buffer = m_threadBuffers.local();
+	if( !buffer )
+	{
+		std::lock_guard<std::mutex> lock( m_threadBuffersMutex );
+		m_allThreadBuffers.push_back( std::make_unique<ThreadBuffer>( m_bufferSize, (int)m_allThreadBuffers.size() ) );
+		buffer = m_allThreadBuffers.back().get();
+	}
+	return *buffer;
+}
+
+void TraceMonitor::writerLoop()
+{
+	std::unique_lock<std::mutex> lock( m_writerMutex );
+	while( !m_stopping )
+	{
+		m_writerCondition.wait_for( lock, g_writeInterval );
+		writeEvents();
+		m_file.flush();
+	}
+}
+
+void TraceMonitor::writeEvents()
+{
+	std::vector<ThreadBuffer *> buffers;
+	{
+		std::lock_guard<std::mutex> lock( m_threadBuffersMutex );
+		for( const auto &b : m_allThreadBuffers )
+		{
+			buffers.push_back( b.get() );
+		}
+	}
+
+	for( ThreadBuffer *buffer : buffers )
+	{
+		if( !buffer->described )
+		{
+			m_file << ( m_firstEvent ? "" : ",\n" );
+			m_file << fmt::format(
+				R"({{"name":"thread_name","ph":"M","pid":1,"tid":{0},"args":{{"name":"Thread {0}"}}}})",
+				buffer->id
+			);
+			m_firstEvent = false;
+			buffer->described = true;
+		}
+
+		const size_t head = buffer->head.load( std::memory_order_acquire );
+		size_t tail = buffer->tail.load( std::memory_order_relaxed );
+		for( ; tail != head; ++tail )
+		{
+			const Event &event = buffer->events[tail & ( buffer->events.size() - 1 )];
+			const double timeInMicroseconds = event.time.count() / 1000.0;
+			m_file << ",\n";
+			if( event.plugName )
+			{
+				m_file << fmt::format(
+					R"({{"name":"{}","cat":"{}","ph":"B","pid":1,"tid":{},"ts":{:.3f},"args":{{"context":"{}"}}}})",
+					escape( *event.plugName ), event.processType.string(), buffer->id, timeInMicroseconds, event.contextHash.toString()
+				);
+			}
+			else
+			{
+				m_file << fmt::format(
+					R"({{"ph":"E","pid":1,"tid":{},"ts":{:.3f}}})",
+					buffer->id, timeInMicroseconds
+				);
+			}
+			// Publish each slot as soon as we're done with it, so that
+			// a waiting producer can continue.
+			buffer->tail.store( tail + 1, std::memory_order_release );
+		}
+	}
+}
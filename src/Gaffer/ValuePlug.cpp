@@ -43,6 +43,7 @@
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
 
+#include "IECore/FileIndexedIO.h"
 #include "IECore/MessageHandler.h"
 
 #include "boost/bind/bind.hpp"
@@ -51,7 +52,15 @@
 
 #include "fmt/format.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
 #include <unordered_set>
 
 using namespace Gaffer;
@@ -94,6 +103,32 @@ const IECore::MurmurHash g_nullHash;
 // order to catch inaccuracies in the cache
 const uint64_t DIRTY_COUNT_RANGE_MAX = std::numeric_limits<uint64_t>::max() / 2;
 
+// Per-thread counters used to accumulate cache statistics. Each counter is
+// only ever modified by the thread that owns it, so we can increment using a
+// relaxed load and store rather than a more expensive `fetch_add()`. The
+// counters are atomic only so that they may be read safely from other threads.
+struct CacheCounters
+{
+	std::atomic_size_t hits{ 0 };
+	std::atomic_size_t misses{ 0 };
+	std::atomic_size_t evictions{ 0 };
+};
+
+inline void incrementCounter( std::atomic_size_t &counter )
+{
+	counter.store( counter.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+}
+
+ValuePlug::CacheStatistics operator - ( const ValuePlug::CacheStatistics &a, const ValuePlug::CacheStatistics &b )
+{
+	ValuePlug::CacheStatistics result;
+	result.hits = a.hits - b.hits;
+	result.misses = a.misses - b.misses;
+	result.collaborations = a.collaborations - b.collaborations;
+	result.evictions = a.evictions - b.evictions;
+	return result;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -147,6 +182,171 @@ size_t tbb_hasher( const HashCacheKey &key )
 	return hash_value( key );
 }
 
+// Hash cache shared by all threads, used for `HashCacheScope::Shared`. This
+// is a lossy table where each key maps to a single slot, and storing a new
+// entry simply replaces whatever occupied the slot before. This avoids the
+// bookkeeping of an LRU cache, and allows lookups to proceed without taking
+// any locks. Each slot is protected by a sequence lock : writers make the
+// sequence number odd while modifying the slot, and readers discard anything
+// they read while a write was in progress.
+class SharedHashCache
+{
+
+	public :
+
+		SharedHashCache( size_t maxEntries )
+			:	m_size( capacity( maxEntries ) ), m_slots( new Slot[m_size] )
+		{
+		}
+
+		// Returns the number of slots that will be used to store
+		// `maxEntries`, which is rounded up to a power of two so that
+		// we can use a mask to find the slot for a key.
+		static size_t capacity( size_t maxEntries )
+		{
+			size_t result = 1;
+			while( result < maxEntries )
+			{
+				result *= 2;
+			}
+			return result;
+		}
+
+		size_t capacity() const
+		{
+			return m_size;
+		}
+
+		bool get( const HashCacheKey &key, IECore::MurmurHash &value ) const
+		{
+			const Slot &slot = m_slots[slotIndex( key )];
+
+			const uint64_t sequence = slot.sequence.load( std::memory_order_acquire );
+			if( sequence & 1 )
+			{
+				// Write in progress.
+				return false;
+			}
+
+			const ValuePlug *plug = slot.plug.load( std::memory_order_relaxed );
+			const uint64_t contextHash1 = slot.contextHash1.load( std::memory_order_relaxed );
+			const uint64_t contextHash2 = slot.contextHash2.load( std::memory_order_relaxed );
+			const uint64_t dirtyCount = slot.dirtyCount.load( std::memory_order_relaxed );
+			const uint64_t value1 = slot.value1.load( std::memory_order_relaxed );
+			const uint64_t value2 = slot.value2.load( std::memory_order_relaxed );
+
+			std::atomic_thread_fence( std::memory_order_acquire );
+			if( slot.sequence.load( std::memory_order_relaxed ) != sequence )
+			{
+				// Slot was modified while we were reading.
+				return false;
+			}
+
+			if(
+				plug != key.plug || dirtyCount != key.dirtyCount ||
+				contextHash1 != key.contextHash.h1() || contextHash2 != key.contextHash.h2()
+			)
+			{
+				return false;
+			}
+
+			value = IECore::MurmurHash( value1, value2 );
+			return true;
+		}
+
+		// Returns true if storing the value evicted a different entry.
+		bool set( const HashCacheKey &key, const IECore::MurmurHash &value )
+		{
+			Slot &slot = m_slots[slotIndex( key )];
+
+			uint64_t sequence = slot.sequence.load( std::memory_order_relaxed );
+			if( ( sequence & 1 ) || !slot.sequence.compare_exchange_strong( sequence, sequence + 1, std::memory_order_acquire ) )
+			{
+				// Another thread is writing to the slot. Since this is
+				// only a cache, we just leave them to it.
+				return false;
+			}
+			std::atomic_thread_fence( std::memory_order_release );
+
+			const ValuePlug *previousPlug = slot.plug.load( std::memory_order_relaxed );
+			const bool evicted =
+				previousPlug && (
+					previousPlug != key.plug ||
+					slot.dirtyCount.load( std::memory_order_relaxed ) != key.dirtyCount ||
+					slot.contextHash1.load( std::memory_order_relaxed ) != key.contextHash.h1() ||
+					slot.contextHash2.load( std::memory_order_relaxed ) != key.contextHash.h2()
+				)
+			;
+
+			slot.plug.store( key.plug, std::memory_order_relaxed );
+			slot.contextHash1.store( key.contextHash.h1(), std::memory_order_relaxed );
+			slot.contextHash2.store( key.contextHash.h2(), std::memory_order_relaxed );
+			slot.dirtyCount.store( key.dirtyCount, std::memory_order_relaxed );
+			slot.value1.store( value.h1(), std::memory_order_relaxed );
+			slot.value2.store( value.h2(), std::memory_order_relaxed );
+
+			slot.sequence.store( sequence + 2, std::memory_order_release );
+			return evicted;
+		}
+
+		void clear()
+		{
+			for( size_t i = 0; i < m_size; ++i )
+			{
+				Slot &slot = m_slots[i];
+				uint64_t sequence = slot.sequence.load( std::memory_order_relaxed );
+				while( ( sequence & 1 ) || !slot.sequence.compare_exchange_weak( sequence, sequence + 1, std::memory_order_acquire ) )
+				{
+					// Writes are very brief, so we just spin until we
+					// can take ownership of the slot.
+					sequence = slot.sequence.load( std::memory_order_relaxed );
+				}
+				std::atomic_thread_fence( std::memory_order_release );
+				slot.plug.store( nullptr, std::memory_order_relaxed );
+				slot.sequence.store( sequence + 2, std::memory_order_release );
+			}
+		}
+
+		// Returns the number of occupied slots. This is approximate
+		// in the presence of concurrent writes.
+		size_t size() const
+		{
+			size_t result = 0;
+			for( size_t i = 0; i < m_size; ++i )
+			{
+				if( m_slots[i].plug.load( std::memory_order_relaxed ) )
+				{
+					result++;
+				}
+			}
+			return result;
+		}
+
+	private :
+
+		// Aligned so that each slot occupies its own cache line, and
+		// writers to neighbouring slots don't contend.
+		struct alignas( 64 ) Slot
+		{
+			std::atomic_uint64_t sequence{ 0 };
+			std::atomic<const ValuePlug *> plug{ nullptr };
+			std::atomic_uint64_t contextHash1{ 0 };
+			std::atomic_uint64_t contextHash2{ 0 };
+			std::atomic_uint64_t dirtyCount{ 0 };
+			std::atomic_uint64_t value1{ 0 };
+			std::atomic_uint64_t value2{ 0 };
+		};
+
+		size_t slotIndex( const HashCacheKey &key ) const
+		{
+			return hash_value( key ) & ( m_size - 1 );
+		}
+
+		const size_t m_size;
+		std::unique_ptr<Slot[]> m_slots;
+
+};
+
 ValuePlug::HashCacheMode defaultHashCacheMode()
 {
 	/// \todo Remove
@@ -258,6 +458,7 @@ class ValuePlug::HashProcess : public Process
 			// we can repeat the process for `Checked` mode.
 
 			const bool forceMonitoring = Process::forceMonitoring( threadState, p, staticType );
+			SharedHashCache *sharedCache = g_hashCacheScope == HashCacheScope::Shared ? g_sharedCache.load( std::memory_order_acquire ) : nullptr;
 
 			auto acquireHash = [&]( const HashCacheKey &cacheKey ) {
 
@@ -270,11 +471,22 @@ class ValuePlug::HashProcess : public Process
 					throw IECore::Exception(  "Dirty count exceeded max. Either you've left Gaffer running for 100 million years, or a strange bug is incrementing dirty counts way too fast." );
 				}
 
-				// Check for an already-cached value in our thread-local cache, and return it if we have one.
+				// Check for an already-cached value in our thread-local cache (or the
+				// shared cache), and return it if we have one.
 				if( !forceMonitoring )
 				{
-					if( auto result = threadData.cache.getIfCached( cacheKey ) )
+					if( sharedCache )
+					{
+						IECore::MurmurHash result;
+						if( sharedCache->get( cacheKey, result ) )
+						{
+							incrementCounter( threadData.statistics.hits );
+							return result;
+						}
+					}
+					else if( auto result = threadData.cache.getIfCached( cacheKey ) )
 					{
+						incrementCounter( threadData.statistics.hits );
 						return *result;
 					}
 				}
@@ -284,6 +496,7 @@ class ValuePlug::HashProcess : public Process
 				IECore::MurmurHash result;
 				if( cachePolicy == CachePolicy::Default )
 				{
+					incrementCounter( threadData.statistics.misses );
 					result = HashProcess( p, plug, computeNode ).run();
 				}
 				else
@@ -295,15 +508,27 @@ class ValuePlug::HashProcess : public Process
 					}
 					if( cachedValue )
 					{
+						incrementCounter( threadData.statistics.hits );
 						result = *cachedValue;
 					}
 					else
 					{
+						incrementCounter( threadData.statistics.misses );
 						result = Process::acquireCollaborativeResult<HashProcess>( cacheKey, p, plug, computeNode );
 					}
 				}
 				// Update local cache and return result
-				threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
+				if( sharedCache )
+				{
+					if( sharedCache->set( cacheKey, result ) )
+					{
+						incrementCounter( threadData.statistics.evictions );
+					}
+				}
+				else
+				{
+					threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
+				}
 				return result;
 			};
 
@@ -353,11 +578,16 @@ class ValuePlug::HashProcess : public Process
 		{
 			g_cacheSizeLimit = maxEntriesPerThread;
 			g_cache.setMaxCost( g_cacheSizeLimit );
+			updateSharedCache();
 		}
 
 		static void clearCache( bool now = false )
 		{
 			g_cache.clear();
+			if( SharedHashCache *sharedCache = g_sharedCache.load( std::memory_order_acquire ) )
+			{
+				sharedCache->clear();
+			}
 			// It's not documented explicitly, but it is safe to iterate over an
 			// `enumerable_thread_specific` while `local()` is being called on
 			// other threads, because the underlying container is a
@@ -385,6 +615,11 @@ class ValuePlug::HashProcess : public Process
 		static size_t totalCacheUsage()
 		{
 			size_t usage = g_cache.currentCost();
+			SharedHashCache *sharedCache = g_sharedCache.load( std::memory_order_acquire );
+			if( sharedCache && g_hashCacheScope == HashCacheScope::Shared )
+			{
+				usage += sharedCache->size();
+			}
 			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
 			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
 			{
@@ -417,6 +652,31 @@ class ValuePlug::HashProcess : public Process
 			return g_hashCacheMode;
 		}
 
+		static void setHashCacheScope( ValuePlug::HashCacheScope scope )
+		{
+			// > Note : Until `updateSharedCache()` has allocated the shared
+			// > cache, threads will continue to use their own caches.
+			g_hashCacheScope = scope;
+			updateSharedCache();
+		}
+
+		static ValuePlug::HashCacheScope getHashCacheScope()
+		{
+			return g_hashCacheScope;
+		}
+
+		static ValuePlug::CacheStatistics statistics()
+		{
+			std::lock_guard<std::mutex> lock( g_statisticsMutex );
+			return accumulateStatistics() - g_statisticsBaseline;
+		}
+
+		static void resetStatistics()
+		{
+			std::lock_guard<std::mutex> lock( g_statisticsMutex );
+			g_statisticsBaseline = accumulateStatistics();
+		}
+
 		static const IECore::InternedString staticType;
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
@@ -461,6 +721,12 @@ class ValuePlug::HashProcess : public Process
 			return 1;
 		}
 
+		CacheType::Retention cacheRetention( size_t cost ) const
+		{
+			// Hashes are uniformly cheap, so we always use LRU.
+			return 0;
+		}
+
 	private :
 
 		const ComputeNode *m_computeNode;
@@ -471,8 +737,17 @@ class ValuePlug::HashProcess : public Process
 		struct ThreadData
 		{
 			// Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
-			ThreadData() : cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false ), clearCache( 0 ) {}
+			ThreadData()
+				:	cache(
+						CacheType::GetterFunction(), g_cacheSizeLimit,
+						[this] ( const HashCacheKey &key, const IECore::MurmurHash &value ) { incrementCounter( statistics.evictions ); },
+						/* cacheErrors = */ false
+					),
+					clearCache( 0 )
+			{
+			}
 			using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Serial>;
+			CacheCounters statistics;
 			CacheType cache;
 			// Flag to request that hashCache be cleared.
 			std::atomic_int clearCache;
@@ -481,6 +756,53 @@ class ValuePlug::HashProcess : public Process
 		static tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance > g_threadData;
 		static std::atomic_size_t g_cacheSizeLimit;
 
+		static void globalCacheRemovalCallback( const HashCacheKey &key, const IECore::MurmurHash &value )
+		{
+			incrementCounter( g_threadData.local().statistics.evictions );
+		}
+
+		static ValuePlug::CacheStatistics accumulateStatistics()
+		{
+			ValuePlug::CacheStatistics result;
+			for( const auto &threadData : g_threadData )
+			{
+				result.hits += threadData.statistics.hits.load( std::memory_order_relaxed );
+				result.misses += threadData.statistics.misses.load( std::memory_order_relaxed );
+				result.evictions += threadData.statistics.evictions.load( std::memory_order_relaxed );
+			}
+			result.collaborations = Process::collaborationCount<HashProcess>();
+			return result;
+		}
+
+		static std::mutex g_statisticsMutex;
+		static ValuePlug::CacheStatistics g_statisticsBaseline;
+
+		// Creates or resizes the shared cache to match `g_cacheSizeLimit`.
+		// Other threads may still be using the previous cache, so rather than
+		// destroy it we keep it alive in `g_sharedCaches`. Resizing is rare,
+		// and usually happens at most once during startup.
+		static void updateSharedCache()
+		{
+			std::lock_guard<std::mutex> lock( g_sharedCacheMutex );
+			SharedHashCache *current = g_sharedCache.load( std::memory_order_relaxed );
+			if( current && current->capacity() == SharedHashCache::capacity( g_cacheSizeLimit ) )
+			{
+				return;
+			}
+			if( !current && g_hashCacheScope != HashCacheScope::Shared )
+			{
+				// Don't allocate until we need to.
+				return;
+			}
+			g_sharedCaches.emplace_back( new SharedHashCache( g_cacheSizeLimit ) );
+			g_sharedCache.store( g_sharedCaches.back().get(), std::memory_order_release );
+		}
+
+		static std::atomic<HashCacheScope> g_hashCacheScope;
+		static std::atomic<SharedHashCache *> g_sharedCache;
+		static std::mutex g_sharedCacheMutex;
+		static std::vector<std::unique_ptr<SharedHashCache>> g_sharedCaches;
+
 };
 
 const IECore::InternedString ValuePlug::HashProcess::staticType( ValuePlug::hashProcessType() );
@@ -488,9 +810,548 @@ tbb::enumerable_thread_specific<ValuePlug::HashProcess::ThreadData, tbb::cache_a
 // Default limit corresponds to a cost of roughly 25Mb per thread.
 std::atomic_size_t ValuePlug::HashProcess::g_cacheSizeLimit( 128000 );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
-ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
+ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::GetterFunction(), g_cacheSizeLimit, globalCacheRemovalCallback, /* cacheErrors = */ false );
 std::atomic<uint64_t> ValuePlug::HashProcess::g_legacyGlobalDirtyCount( 0 );
 ValuePlug::HashCacheMode ValuePlug::HashProcess::g_hashCacheMode( defaultHashCacheMode() );
+std::mutex ValuePlug::HashProcess::g_statisticsMutex;
+ValuePlug::CacheStatistics ValuePlug::HashProcess::g_statisticsBaseline;
+std::atomic<ValuePlug::HashCacheScope> ValuePlug::HashProcess::g_hashCacheScope( ValuePlug::HashCacheScope::PerThread );
+std::atomic<SharedHashCache *> ValuePlug::HashProcess::g_sharedCache( nullptr );
+std::mutex ValuePlug::HashProcess::g_sharedCacheMutex;
+std::vector<std::unique_ptr<SharedHashCache>> ValuePlug::HashProcess::g_sharedCaches;
+
+//////////////////////////////////////////////////////////////////////////
+// The PersistentCache provides an optional second-level cache for the
+// results of ComputeProcesses using `CachePolicy::Persistent`. Each result
+// is stored in its own file, named after the compute hash, so the cache
+// can be shared between processes. Files are written to a temporary name
+// and then renamed into place, so that readers never see partial files.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+class PersistentCache
+{
+
+	public :
+
+		static std::string getDirectory()
+		{
+			std::lock_guard<std::mutex> lock( g_directoryMutex );
+			return g_directory.generic_string();
+		}
+
+		static void setDirectory( const std::string &directory )
+		{
+			std::lock_guard<std::mutex> lock( g_directoryMutex );
+			g_directory = directory;
+			if( !g_directory.empty() )
+			{
+				std::filesystem::create_directories( g_directory );
+			}
+			g_enabled = !g_directory.empty();
+			g_usage = g_enabled ? scan( g_directory ).size : 0;
+		}
+
+		static bool enabled()
+		{
+			return g_enabled.load( std::memory_order_relaxed );
+		}
+
+		static size_t getSizeLimit()
+		{
+			return g_sizeLimit;
+		}
+
+		static void setSizeLimit( size_t bytes )
+		{
+			g_sizeLimit = bytes;
+			limitUsage();
+		}
+
+		static size_t usage()
+		{
+			return g_usage;
+		}
+
+		static void clear()
+		{
+			const std::filesystem::path directory = getDirectory();
+			if( directory.empty() )
+			{
+				return;
+			}
+			for( const auto &file : scan( directory ).files )
+			{
+				std::error_code ec;
+				std::filesystem::remove( file.path, ec );
+			}
+			g_usage = 0;
+		}
+
+		// Returns null if the value is not in the cache.
+		static IECore::ConstObjectPtr get( const IECore::MurmurHash &hash )
+		{
+			const std::filesystem::path path = filePath( hash );
+			std::error_code ec;
+			if( path.empty() || !std::filesystem::exists( path, ec ) )
+			{
+				return nullptr;
+			}
+
+			try
+			{
+				IECore::FileIndexedIOPtr file = new IECore::FileIndexedIO(
+					path.generic_string(), IECore::IndexedIO::rootPath, IECore::IndexedIO::Read
+				);
+				IECore::ConstObjectPtr result = IECore::Object::load( file, "object" );
+				// Update the modification time, so that `limitUsage()` knows we
+				// used the file recently.
+				std::filesystem::last_write_time( path, std::filesystem::file_time_type::clock::now(), ec );
+				return result;
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg(
+					IECore::Msg::Warning, "ValuePlug",
+					fmt::format( "Removing unreadable persistent cache file \"{}\" : {}", path.generic_string(), e.what() )
+				);
+				std::filesystem::remove( path, ec );
+				return nullptr;
+			}
+		}
+
+		static void set( const IECore::MurmurHash &hash, const IECore::Object *value )
+		{
+			const std::filesystem::path path = filePath( hash );
+			std::error_code ec;
+			if( path.empty() || std::filesystem::exists( path, ec ) )
+			{
+				// Cache disabled, or another thread or process has
+				// stored the same value already.
+				return;
+			}
+
+			std::filesystem::path tmpPath = path;
+			tmpPath += fmt::format( ".{:x}.tmp", uniqueId() );
+
+			try
+			{
+				std::filesystem::create_directories( path.parent_path() );
+				{
+					IECore::FileIndexedIOPtr file = new IECore::FileIndexedIO(
+						tmpPath.generic_string(), IECore::IndexedIO::rootPath, IECore::IndexedIO::Write
+					);
+					value->save( file, "object" );
+				}
+				std::filesystem::rename( tmpPath, path );
+				g_usage += std::filesystem::file_size( path );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg(
+					IECore::Msg::Warning, "ValuePlug",
+					fmt::format( "Unable to write persistent cache file \"{}\" : {}", path.generic_string(), e.what() )
+				);
+				std::filesystem::remove( tmpPath, ec );
+				return;
+			}
+
+			if( g_usage > g_sizeLimit )
+			{
+				limitUsage();
+			}
+		}
+
+	private :
+
+		static std::filesystem::path filePath( const IECore::MurmurHash &hash )
+		{
+			std::lock_guard<std::mutex> lock( g_directoryMutex );
+			if( g_directory.empty() )
+			{
+				return std::filesystem::path();
+			}
+			// Split files between subdirectories using the first two
+			// characters of the hash, to avoid huge directories.
+			const std::string name = hash.toString();
+			return g_directory / name.substr( 0, 2 ) / ( name + ".cob" );
+		}
+
+		// Used to give each temporary file a name that is unique across
+		// threads and processes.
+		static uint64_t uniqueId()
+		{
+			thread_local std::mt19937_64 g_generator( std::random_device{}() );
+			return g_generator();
+		}
+
+		struct File
+		{
+			std::filesystem::file_time_type time;
+			size_t size;
+			std::filesystem::path path;
+		};
+
+		struct ScanResult
+		{
+			std::vector<File> files;
+			size_t size = 0;
+		};
+
+		// Returns all the cache files in `directory`. We only consider
+		// files named using our convention, so that we never remove
+		// anything that doesn't belong to us.
+		static ScanResult scan( const std::filesystem::path &directory )
+		{
+			ScanResult result;
+			std::error_code ec;
+			for( std::filesystem::recursive_directory_iterator it( directory, ec ), eIt; it != eIt; it.increment( ec ) )
+			{
+				if( ec )
+				{
+					break;
+				}
+				const std::filesystem::path &path = it->path();
+				if( path.extension() != ".cob" || path.stem().string().size() != 32 || !it->is_regular_file( ec ) )
+				{
+					continue;
+				}
+				File file = { it->last_write_time( ec ), (size_t)it->file_size( ec ), path };
+				if( !ec )
+				{
+					result.size += file.size;
+					result.files.push_back( file );
+				}
+			}
+			return result;
+		}
+
+		// Removes the least recently used files until we are comfortably
+		// below the size limit. The scan is relatively expensive, so we
+		// remove enough files to leave some headroom before the next one.
+		static void limitUsage()
+		{
+			std::unique_lock<std::mutex> lock( g_limitMutex, std::try_to_lock );
+			if( !lock.owns_lock() )
+			{
+				// Another thread is doing the work already.
+				return;
+			}
+
+			const std::filesystem::path directory = getDirectory();
+			if( directory.empty() || g_usage <= g_sizeLimit )
+			{
+				return;
+			}
+
+			ScanResult scanResult = scan( directory );
+			std::sort(
+				scanResult.files.begin(), scanResult.files.end(),
+				[] ( const File &a, const File &b ) { return a.time < b.time; }
+			);
+
+			const size_t targetSize = g_sizeLimit - g_sizeLimit / 10;
+			for( const auto &file : scanResult.files )
+			{
+				if( scanResult.size <= targetSize )
+				{
+					break;
+				}
+				std::error_code ec;
+				if( std::filesystem::remove( file.path, ec ) )
+				{
+					scanResult.size -= file.size;
+				}
+			}
+
+			g_usage = scanResult.size;
+		}
+
+		static std::mutex g_directoryMutex;
+		static std::filesystem::path g_directory;
+		static std::atomic_bool g_enabled;
+		static std::atomic_size_t g_sizeLimit;
+		static std::atomic_size_t g_usage;
+		static std::mutex g_limitMutex;
+
+};
+
+std::mutex PersistentCache::g_directoryMutex;
+std::filesystem::path PersistentCache::g_directory;
+std::atomic_bool PersistentCache::g_enabled( false );
+std::atomic_size_t PersistentCache::g_sizeLimit( size_t( 1024 ) * 1024 * 1024 * 10 ); // 10 gigs
+std::atomic_size_t PersistentCache::g_usage( 0 );
+std::mutex PersistentCache::g_limitMutex;
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// The CacheUsageTracker optionally records the node type and plug
+// responsible for each entry in the compute cache, so that memory usage
+// can be attributed when tuning the cache.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+class CacheUsageTracker
+{
+
+	public :
+
+		static bool enabled()
+		{
+			return g_enabled.load( std::memory_order_relaxed );
+		}
+
+		static void setEnabled( bool enabled )
+		{
+			g_enabled = enabled;
+			if( !enabled )
+			{
+				for( auto &shard : g_shards )
+				{
+					std::lock_guard<std::mutex> lock( shard.mutex );
+					shard.entries.clear();
+					shard.usage.clear();
+				}
+			}
+		}
+
+		static void inserted( const IECore::MurmurHash &hash, const ValuePlug *plug, size_t cost )
+		{
+			const Node *node = plug->node();
+			const Key key(
+				node ? node->typeName() : "",
+				plug->relativeName( node )
+			);
+
+			Shard &shard = g_shards[shardIndex( hash )];
+			std::lock_guard<std::mutex> lock( shard.mutex );
+			if( !shard.entries.try_emplace( hash, Entry{ key, cost } ).second )
+			{
+				return;
+			}
+			ValuePlug::CacheUsage &usage = shard.usage[key];
+			usage.entries++;
+			usage.bytes += cost;
+		}
+
+		static void removed( const IECore::MurmurHash &hash )
+		{
+			Shard &shard = g_shards[shardIndex( hash )];
+			std::lock_guard<std::mutex> lock( shard.mutex );
+			auto it = shard.entries.find( hash );
+			if( it == shard.entries.end() )
+			{
+				// Entry was added while tracking was disabled.
+				return;
+			}
+			auto usageIt = shard.usage.find( it->second.key );
+			usageIt->second.entries--;
+			usageIt->second.bytes -= it->second.cost;
+			if( !usageIt->second.entries )
+			{
+				shard.usage.erase( usageIt );
+			}
+			shard.entries.erase( it );
+		}
+
+		static ValuePlug::CacheUsageMap usage()
+		{
+			ValuePlug::CacheUsageMap result;
+			for( auto &shard : g_shards )
+			{
+				std::lock_guard<std::mutex> lock( shard.mutex );
+				for( const auto &[key, usage] : shard.usage )
+				{
+					ValuePlug::CacheUsage &u = result[key];
+					u.entries += usage.entries;
+					u.bytes += usage.bytes;
+				}
+			}
+			return result;
+		}
+
+	private :
+
+		using Key = ValuePlug::CacheUsageMap::key_type;
+
+		struct Entry
+		{
+			Key key;
+			size_t cost;
+		};
+
+		// We shard the entries by hash so that threads inserting
+		// different results rarely contend for the same mutex.
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_map<IECore::MurmurHash, Entry> entries;
+			ValuePlug::CacheUsageMap usage;
+		};
+
+		static size_t shardIndex( const IECore::MurmurHash &hash )
+		{
+			return hash.h1() % g_shards.size();
+		}
+
+		static std::atomic_bool g_enabled;
+		static std::array<Shard, 64> g_shards;
+
+};
+
+std::atomic_bool CacheUsageTracker::g_enabled( false );
+std::array<CacheUsageTracker::Shard, 64> CacheUsageTracker::g_shards;
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// EvaluationProfile. This measures the cost of hashing and computing a
+// plug, to decide whether or not it is worth caching at all.
+//////////////////////////////////////////////////////////////////////////
+
+struct ValuePlug::EvaluationProfile
+{
+
+	enum class Mode
+	{
+		Profiling,
+		Direct,
+		Cached
+	};
+
+	std::atomic<Mode> mode = Mode::Profiling;
+	std::atomic_uint32_t evaluations = 0;
+	std::atomic_uint32_t misses = 0;
+	// Accumulated durations in nanoseconds.
+	std::atomic_uint64_t hashDuration = 0;
+	std::atomic_uint64_t computeDuration = 0;
+	// The average cost of a cached evaluation, as measured while profiling.
+	// Direct evaluations that take longer than this revert us to caching.
+	std::atomic_uint64_t cachedCost = 0;
+
+	// Applies any `ComputeNode::DirectEvaluation` override and the result of
+	// profiling to `cachePolicy`. Returns the profile if the evaluation should
+	// contribute to it, and null otherwise.
+	static EvaluationProfile *acquire( const ValuePlug *plug, const ComputeNode *computeNode, CachePolicy &cachePolicy )
+	{
+		switch( computeNode->getDirectEvaluation() )
+		{
+			case ComputeNode::DirectEvaluation::Always :
+				cachePolicy = CachePolicy::Uncached;
+				return nullptr;
+			case ComputeNode::DirectEvaluation::Never :
+				return nullptr;
+			case ComputeNode::DirectEvaluation::Automatic :
+				break;
+		}
+
+		// We only consider the Default policy, since the others are used
+		// for computes expensive enough to spawn tasks.
+		if( cachePolicy != CachePolicy::Default || !g_enabled.load( std::memory_order_relaxed ) )
+		{
+			return nullptr;
+		}
+
+		EvaluationProfile *profile = plug->m_evaluationProfile.load( std::memory_order_acquire );
+		if( !profile )
+		{
+			auto newProfile = std::make_unique<EvaluationProfile>();
+			if( plug->m_evaluationProfile.compare_exchange_strong( profile, newProfile.get() ) )
+			{
+				profile = newProfile.release();
+			}
+		}
+
+		switch( profile->mode.load( std::memory_order_relaxed ) )
+		{
+			case Mode::Direct :
+				cachePolicy = CachePolicy::Uncached;
+				return profile;
+			case Mode::Cached :
+				return nullptr;
+			default :
+				return profile;
+		}
+	}
+
+	// Records a cached evaluation, with `computeDuration` being zero
+	// for cache hits.
+	void addSample( std::chrono::steady_clock::duration hash, std::chrono::steady_clock::duration compute )
+	{
+		const uint32_t n = evaluations.fetch_add( 1, std::memory_order_relaxed ) + 1;
+		hashDuration.fetch_add( nanoseconds( hash ), std::memory_order_relaxed );
+		uint32_t m = misses.load( std::memory_order_relaxed );
+		if( compute != std::chrono::steady_clock::duration::zero() )
+		{
+			m = misses.fetch_add( 1, std::memory_order_relaxed ) + 1;
+			computeDuration.fetch_add( nanoseconds( compute ), std::memory_order_relaxed );
+		}
+
+		if( n < g_minEvaluations || m < g_minMisses )
+		{
+			if( n >= g_maxEvaluations )
+			{
+				// Not enough misses to make computing directly worthwhile.
+				decide( Mode::Cached );
+			}
+			return;
+		}
+
+		// Caching costs us a hash per evaluation plus a compute per miss,
+		// whereas direct evaluation costs us a compute per evaluation.
+		const uint64_t totalCompute = computeDuration.load( std::memory_order_relaxed );
+		const uint64_t cached = ( hashDuration.load( std::memory_order_relaxed ) + totalCompute ) / n;
+		const uint64_t direct = totalCompute / m;
+		cachedCost.store( cached, std::memory_order_relaxed );
+		decide( direct < cached ? Mode::Direct : Mode::Cached );
+	}
+
+	// Returns true if the current direct evaluation should be timed
+	// and passed to `addDirectSample()`.
+	bool sampleDirect()
+	{
+		return ( evaluations.fetch_add( 1, std::memory_order_relaxed ) % g_directSampleInterval ) == 0;
+	}
+
+	void addDirectSample( std::chrono::steady_clock::duration compute )
+	{
+		// Allow some slack for timing noise. Larger durations mean that
+		// the plug is more expensive than it was while profiling, perhaps
+		// because upstream plugs are also now being evaluated directly.
+		if( nanoseconds( compute ) > 2 * cachedCost.load( std::memory_order_relaxed ) )
+		{
+			mode = Mode::Cached;
+		}
+	}
+
+	static std::atomic_bool g_enabled;
+
+	private :
+
+		void decide( Mode decision )
+		{
+			Mode expected = Mode::Profiling;
+			mode.compare_exchange_strong( expected, decision );
+		}
+
+		static uint64_t nanoseconds( std::chrono::steady_clock::duration d )
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>( d ).count();
+		}
+
+		static const uint32_t g_minEvaluations = 32;
+		static const uint32_t g_minMisses = 4;
+		static const uint32_t g_maxEvaluations = 1024;
+		static const uint32_t g_directSampleInterval = 16;
+
+};
+
+std::atomic_bool ValuePlug::EvaluationProfile::g_enabled( false );
 
 //////////////////////////////////////////////////////////////////////////
 // The ComputeProcess manages the task of calling ComputeNode::compute()
@@ -524,6 +1385,28 @@ class ValuePlug::ComputeProcess : public Process
 			g_cache.clear();
 		}
 
+		static void setCacheEvictionMode( CacheEvictionMode mode )
+		{
+			g_cacheEvictionMode = mode;
+		}
+
+		static CacheEvictionMode getCacheEvictionMode()
+		{
+			return g_cacheEvictionMode;
+		}
+
+		static ValuePlug::CacheStatistics statistics()
+		{
+			std::lock_guard<std::mutex> lock( g_statisticsMutex );
+			return accumulateStatistics() - g_statisticsBaseline;
+		}
+
+		static void resetStatistics()
+		{
+			std::lock_guard<std::mutex> lock( g_statisticsMutex );
+			g_statisticsBaseline = accumulateStatistics();
+		}
+
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
 		{
 			const ValuePlug *p = sourcePlug( plug );
@@ -562,12 +1445,23 @@ class ValuePlug::ComputeProcess : public Process
 				cachePolicy = computeNode->computeCachePolicy( p );
 			}
 
+			// The plug may be cheap enough that we're better off evaluating
+			// it directly, without computing a hash.
+
+			EvaluationProfile *profile = computeNode ? EvaluationProfile::acquire( p, computeNode, cachePolicy ) : nullptr;
+
 			// If caching is off then its just a case of using a ComputeProcess
 			// to do the work.
 
 			if( cachePolicy == CachePolicy::Uncached )
 			{
+				const bool sample = profile && profile->sampleDirect();
+				const auto startTime = sample ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
 				owner = ComputeProcess( p, plug, computeNode ).run();
+				if( sample )
+				{
+					profile->addDirectSample( std::chrono::steady_clock::now() - startTime );
+				}
 				return owner.get();
 			}
 
@@ -583,16 +1477,29 @@ class ValuePlug::ComputeProcess : public Process
 			// > `StringPlug::hash()` account for additional processing (such as
 			// > substitutions) performed in public `getValue()` methods _after_
 			// > calling `getValueInternal()`.
+			const auto hashStartTime = profile ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
 			const IECore::MurmurHash hash = precomputedHash ? *precomputedHash : p->ValuePlug::hash();
 
-			if( !Process::forceMonitoring( threadState, plug, staticType ) )
+			const bool forceMonitoring = Process::forceMonitoring( threadState, plug, staticType );
+			if( !forceMonitoring )
 			{
 				if( auto result = g_cache.getIfCached( hash ) )
 				{
+					incrementCounter( g_statistics.local().hits );
+					if( profile )
+					{
+						profile->addSample( std::chrono::steady_clock::now() - hashStartTime, std::chrono::steady_clock::duration::zero() );
+					}
 					// Move avoids unnecessary additional addRef/removeRef.
 					owner = std::move( *result );
 					return owner.get();
 				}
+				incrementCounter( g_statistics.local().misses );
+			}
+			else
+			{
+				// Durations won't be representative of normal operation.
+				profile = nullptr;
 			}
 
 			// The value isn't in the cache, so we'll need to compute it,
@@ -605,7 +1512,18 @@ class ValuePlug::ComputeProcess : public Process
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
 				// before it gets cached.
-				owner = ComputeProcess( p, plug, computeNode ).run();
+				std::chrono::steady_clock::duration duration;
+				{
+					const auto computeStartTime = profile ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+					ComputeProcess process( p, plug, computeNode );
+					owner = process.run();
+					duration = process.m_duration;
+					if( profile )
+					{
+						const auto computeEndTime = std::chrono::steady_clock::now();
+						profile->addSample( computeStartTime - hashStartTime, computeEndTime - computeStartTime );
+					}
+				}
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
 				// triggered by us to have already done the work, and calling
@@ -616,13 +1534,21 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				g_cache.setIfUncached(
+					hash, owner, cacheCostFunction,
+					[duration] ( size_t cost ) { return retention( duration, cost ); },
+					[&hash, p] ( size_t cost ) { cacheInserted( hash, p, cost ); }
+				);
 				return owner.get();
 			}
 			else
 			{
+				// For the Persistent policy, the process consults the persistent
+				// cache. We don't do that when monitoring is forced, because then
+				// the monitor wants to see the compute actually happen.
+				const bool persistent = cachePolicy == CachePolicy::Persistent && !forceMonitoring && PersistentCache::enabled();
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					hash, p, plug, computeNode, &hash, persistent
 				);
 				return owner.get();
 			}
@@ -649,8 +1575,8 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, const IECore::MurmurHash *cacheKey = nullptr, bool persistent = false )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_cacheKey( cacheKey ), m_persistent( persistent ), m_duration( 0 )
 		{
 		}
 
@@ -658,6 +1584,14 @@ class ValuePlug::ComputeProcess : public Process
 		{
 			try
 			{
+				const auto startTime = g_cacheEvictionMode == CacheEvictionMode::CostWeighted ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+				if( m_persistent )
+				{
+					if( IECore::ConstObjectPtr result = PersistentCache::get( *m_cacheKey ) )
+					{
+						return result;
+					}
+				}
 				// Cast is safe because our constructor takes ValuePlugs.
 				const ValuePlug *valuePlug = static_cast<const ValuePlug *>( plug() );
 				if( const ValuePlug *input = valuePlug->getInput<ValuePlug>() )
@@ -683,6 +1617,14 @@ class ValuePlug::ComputeProcess : public Process
 				{
 					throw IECore::Exception( "Compute did not set plug value." );
 				}
+				if( m_persistent )
+				{
+					PersistentCache::set( *m_cacheKey, m_result.get() );
+				}
+				if( startTime != std::chrono::steady_clock::time_point() )
+				{
+					m_duration = std::chrono::steady_clock::now() - startTime;
+				}
 				// Move to avoid unnecessary reference count increment/decrement - we don't
 				// need `m_result` any more.
 				return std::move( m_result );
@@ -702,17 +1644,86 @@ class ValuePlug::ComputeProcess : public Process
 			return v->memoryUsage();
 		}
 
+		CacheType::Retention cacheRetention( size_t cost ) const
+		{
+			return retention( m_duration, cost );
+		}
+
+		void cacheInserted( size_t cost ) const
+		{
+			cacheInserted( *m_cacheKey, static_cast<const ValuePlug *>( plug() ), cost );
+		}
+
 	private :
 
+		// Returns a retention proportional to the logarithm of the time taken
+		// to compute each byte of the result. The logarithm keeps the range
+		// manageable, while still allowing an expensive result to outlive
+		// many cheap ones. If the duration wasn't measured, or the value was
+		// loaded from the persistent cache, the result is 0 and we fall back
+		// to LRU.
+		static CacheType::Retention retention( std::chrono::steady_clock::duration duration, size_t cost )
+		{
+			if( duration == std::chrono::steady_clock::duration::zero() )
+			{
+				return 0;
+			}
+			const double nanosecondsPerByte = std::chrono::duration<double, std::nano>( duration ).count() / std::max<size_t>( cost, 1 );
+			return (CacheType::Retention)std::min( 16.0, std::log2( 1.0 + nanosecondsPerByte ) );
+		}
+
+		static void cacheInserted( const IECore::MurmurHash &key, const ValuePlug *plug, size_t cost )
+		{
+			if( CacheUsageTracker::enabled() )
+			{
+				CacheUsageTracker::inserted( key, plug, cost );
+			}
+		}
+
+		static void cacheRemovalCallback( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &value )
+		{
+			incrementCounter( g_statistics.local().evictions );
+			if( CacheUsageTracker::enabled() )
+			{
+				CacheUsageTracker::removed( key );
+			}
+		}
+
+		static ValuePlug::CacheStatistics accumulateStatistics()
+		{
+			ValuePlug::CacheStatistics result;
+			for( const auto &counters : g_statistics )
+			{
+				result.hits += counters.hits.load( std::memory_order_relaxed );
+				result.misses += counters.misses.load( std::memory_order_relaxed );
+				result.evictions += counters.evictions.load( std::memory_order_relaxed );
+			}
+			result.collaborations = Process::collaborationCount<ComputeProcess>();
+			return result;
+		}
+
 		const ComputeNode *m_computeNode;
+		const IECore::MurmurHash *m_cacheKey;
+		const bool m_persistent;
 		IECore::ConstObjectPtr m_result;
+		mutable std::chrono::steady_clock::duration m_duration;
+
+		static std::atomic<CacheEvictionMode> g_cacheEvictionMode;
+
+		static tbb::enumerable_thread_specific<CacheCounters, tbb::cache_aligned_allocator<CacheCounters>, tbb::ets_key_per_instance> g_statistics;
+		static std::mutex g_statisticsMutex;
+		static ValuePlug::CacheStatistics g_statisticsBaseline;
 
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
-ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, cacheRemovalCallback, /* cacheErrors = */ false ); // 1 gig
+std::atomic<ValuePlug::CacheEvictionMode> ValuePlug::ComputeProcess::g_cacheEvictionMode( ValuePlug::CacheEvictionMode::LeastRecentlyUsed );
+tbb::enumerable_thread_specific<CacheCounters, tbb::cache_aligned_allocator<CacheCounters>, tbb::ets_key_per_instance> ValuePlug::ComputeProcess::g_statistics;
+std::mutex ValuePlug::ComputeProcess::g_statisticsMutex;
+ValuePlug::CacheStatistics ValuePlug::ComputeProcess::g_statisticsBaseline;
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -794,14 +1805,14 @@ GAFFER_PLUG_DEFINE_TYPE( ValuePlug );
 /// even creating the values before figuring out if we've already got them somewhere).
 ValuePlug::ValuePlug( const std::string &name, Direction direction,
 	IECore::ConstObjectPtr defaultValue, unsigned flags )
-	:	Plug( name, direction, flags ), m_defaultValue( defaultValue ), m_staticValue( defaultValue ), m_dirtyCount( g_dirtyCountEpoch )
+	:	Plug( name, direction, flags ), m_defaultValue( defaultValue ), m_staticValue( defaultValue ), m_dirtyCount( g_dirtyCountEpoch ), m_evaluationProfile( nullptr )
 {
 	assert( m_defaultValue );
 	assert( m_staticValue );
 }
 
 ValuePlug::ValuePlug( const std::string &name, Direction direction, unsigned flags )
-	:	Plug( name, direction, flags ), m_defaultValue( nullptr ), m_staticValue( nullptr ), m_dirtyCount( g_dirtyCountEpoch )
+	:	Plug( name, direction, flags ), m_defaultValue( nullptr ), m_staticValue( nullptr ), m_dirtyCount( g_dirtyCountEpoch ), m_evaluationProfile( nullptr )
 {
 }
 
@@ -825,6 +1836,8 @@ ValuePlug::~ValuePlug()
 	// Legacy mode doesn't use `m_dirtyCount` or `g_dirtyCountEpoch`, so needs
 	// dirtying separately.
 	HashProcess::dirtyLegacyCache();
+
+	delete m_evaluationProfile.load();
 }
 
 bool ValuePlug::acceptsChild( const GraphComponent *potentialChild ) const
@@ -1154,6 +2167,62 @@ void ValuePlug::clearCache()
 	ComputeProcess::clearCache();
 }
 
+void ValuePlug::setCacheEvictionMode( CacheEvictionMode mode )
+{
+	ComputeProcess::setCacheEvictionMode( mode );
+}
+
+ValuePlug::CacheEvictionMode ValuePlug::getCacheEvictionMode()
+{
+	return ComputeProcess::getCacheEvictionMode();
+}
+
+void ValuePlug::setAutomaticDirectEvaluationEnabled( bool enabled )
+{
+	EvaluationProfile::g_enabled = enabled;
+}
+
+bool ValuePlug::getAutomaticDirectEvaluationEnabled()
+{
+	return EvaluationProfile::g_enabled;
+}
+
+bool ValuePlug::isDirectlyEvaluated( const ValuePlug *plug )
+{
+	const EvaluationProfile *profile = plug->m_evaluationProfile.load( std::memory_order_acquire );
+	return profile && profile->mode == EvaluationProfile::Mode::Direct;
+}
+
+std::string ValuePlug::getPersistentCacheDirectory()
+{
+	return PersistentCache::getDirectory();
+}
+
+void ValuePlug::setPersistentCacheDirectory( const std::string &directory )
+{
+	PersistentCache::setDirectory( directory );
+}
+
+size_t ValuePlug::getPersistentCacheSizeLimit()
+{
+	return PersistentCache::getSizeLimit();
+}
+
+void ValuePlug::setPersistentCacheSizeLimit( size_t bytes )
+{
+	PersistentCache::setSizeLimit( bytes );
+}
+
+size_t ValuePlug::persistentCacheUsage()
+{
+	return PersistentCache::usage();
+}
+
+void ValuePlug::clearPersistentCache()
+{
+	PersistentCache::clear();
+}
+
 size_t ValuePlug::getHashCacheSizeLimit()
 {
 	return HashProcess::getCacheSizeLimit();
@@ -1184,6 +2253,47 @@ ValuePlug::HashCacheMode ValuePlug::getHashCacheMode()
 	return HashProcess::getHashCacheMode();
 }
 
+void ValuePlug::setHashCacheScope( HashCacheScope scope )
+{
+	HashProcess::setHashCacheScope( scope );
+}
+
+ValuePlug::HashCacheScope ValuePlug::getHashCacheScope()
+{
+	return HashProcess::getHashCacheScope();
+}
+
+ValuePlug::CacheStatistics ValuePlug::computeCacheStatistics()
+{
+	return ComputeProcess::statistics();
+}
+
+ValuePlug::CacheStatistics ValuePlug::hashCacheStatistics()
+{
+	return HashProcess::statistics();
+}
+
+void ValuePlug::resetCacheStatistics()
+{
+	ComputeProcess::resetStatistics();
+	HashProcess::resetStatistics();
+}
+
+void ValuePlug::setCacheUsageTrackingEnabled( bool enabled )
+{
+	CacheUsageTracker::setEnabled( enabled );
+}
+
+bool ValuePlug::getCacheUsageTrackingEnabled()
+{
+	return CacheUsageTracker::enabled();
+}
+
+ValuePlug::CacheUsageMap ValuePlug::cacheMemoryUsageByNodeType()
+{
+	return CacheUsageTracker::usage();
+}
+
 const IECore::InternedString &ValuePlug::hashProcessType()
 {
 	static IECore::InternedString g_hashProcessType( "computeNode:hash" );
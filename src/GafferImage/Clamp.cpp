@@ -220,42 +220,27 @@ void Clamp::processChannelData( const Gaffer::Context *context, const ImagePlug
 	const bool minClampToEnabled = minClampToEnabledPlug()->getValue();
 	const bool maxClampToEnabled = maxClampToEnabledPlug()->getValue();
 
-	std::vector<float> &out = outData->writable();
+	const float minResult = minClampToEnabled ? minClampTo : minimum;
+	const float maxResult = maxClampToEnabled ? maxClampTo : maximum;
 
-	std::vector<float>::iterator outDataIterator;
+	// Branch-free loops with the enabled checks hoisted out, so that
+	// the compiler can vectorise them.
+	float *out = outData->writable().data();
+	const size_t size = outData->readable().size();
 
-	for (outDataIterator = out.begin(); outDataIterator != out.end(); ++outDataIterator)
+	if( minimumEnabled )
 	{
-
-		if (minimumEnabled)
+		for( size_t i = 0; i < size; ++i )
 		{
-			if (*outDataIterator < minimum)
-			{
-				if (minClampToEnabled)
-				{
-					*outDataIterator = minClampTo;
-				}
-				else
-				{
-					*outDataIterator = minimum;
-				}
-			}
+			out[i] = out[i] < minimum ? minResult : out[i];
 		}
+	}
 
-		if (maximumEnabled)
+	if( maximumEnabled )
+	{
+		for( size_t i = 0; i < size; ++i )
 		{
-			if (*outDataIterator > maximum)
-			{
-				if (maxClampToEnabled)
-				{
-					*outDataIterator = maxClampTo;
-				}
-				else
-				{
-					*outDataIterator = maximum;
-				}
-			}
+			out[i] = out[i] > maximum ? maxResult : out[i];
 		}
-
 	}
 }
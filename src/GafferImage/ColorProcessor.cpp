@@ -43,6 +43,9 @@
 #include "IECore/NullObject.h"
 #include "IECore/StringAlgo.h"
 
+#include <algorithm>
+#include <array>
+
 using namespace std;
 using namespace IECore;
 using namespace Gaffer;
@@ -61,6 +64,39 @@ IE_CORE_DECLAREPTR( ColorProcessorData );
 
 const IECore::InternedString g_layerNameKey( "image:colorProcessor:__layerName" );
 
+void unpremultiply( FloatVectorData *channel, const FloatVectorData *alpha )
+{
+	const float *A = &alpha->readable().front();
+	float *C = &channel->writable().front();
+	const size_t samples = alpha->readable().size();
+	for( size_t j = 0; j < samples; j++ )
+	{
+		if( *A != 0 )
+		{
+			*C /= *A;
+		}
+		A++;
+		C++;
+	}
+}
+
+void premultiply( FloatVectorData *channel, const FloatVectorData *alpha )
+{
+	const float *A = &alpha->readable().front();
+	float *C = &channel->writable().front();
+	const size_t samples = alpha->readable().size();
+	for( size_t j = 0; j < samples; j++ )
+	{
+		// Pixels with no alpha aren't touched by either the unpremult or repremult
+		if( *A != 0 )
+		{
+			*C *= *A;
+		}
+		A++;
+		C++;
+	}
+}
+
 } // namespace
 
 GAFFER_NODE_DEFINE_TYPE( ColorProcessor );
@@ -243,6 +279,13 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 		const string &layerName = context->get<string>( g_layerNameKey );
 
+		// If we're fed by other ColorProcessors, we fuse their processing into
+		// our own, reading from the start of the chain and applying all the
+		// functions in a single pass. This avoids computing and caching the
+		// intermediate results.
+		std::vector<ColorProcessorFunction> upstreamProcessors;
+		const ImagePlug *input = fusedInput( context, layerName, channelNames, unpremult, upstreamProcessors );
+
 		FloatVectorDataPtr rgb[3];
 		ConstFloatVectorDataPtr alpha;
 		int samples = -1;
@@ -252,7 +295,7 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 			if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
 			{
 				channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-				alpha = inPlug()->channelDataPlug()->getValue();
+				alpha = input->channelDataPlug()->getValue();
 			}
 
 			int i = 0;
@@ -262,23 +305,13 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 				if( ImageAlgo::channelExists( channelNames, channelName ) )
 				{
 					channelDataScope.setChannelName( &channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
+					rgb[i] = input->channelDataPlug()->getValue()->copy();
 
 					samples = rgb[i]->readable().size();
 
 					if( unpremult && alpha )
 					{
-						const float *A = &alpha->readable().front();
-						float *C = &rgb[i]->writable().front();
-						for( int j = 0; j < samples; j++ )
-						{
-							if( *A != 0 )
-							{
-								*C /= *A;
-							}
-							A++;
-							C++;
-						}
+						unpremultiply( rgb[i].get(), alpha.get() );
 					}
 				}
 				else
@@ -304,27 +337,29 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 		}
 
+		for( const auto &upstreamProcessor : upstreamProcessors )
+		{
+			upstreamProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+			if( unpremult && alpha )
+			{
+				// Repeat the premultiplication performed by the upstream node
+				// and the unpremultiplication performed by the next node, so
+				// that the result is identical to unfused evaluation. This is
+				// necessary because we use the same hash for both.
+				for( int i = 0; i < 3; i++ )
+				{
+					premultiply( rgb[i].get(), alpha.get() );
+					unpremultiply( rgb[i].get(), alpha.get() );
+				}
+			}
+		}
 		colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
 
 		if( unpremult && alpha )
 		{
 			for( int i = 0; i < 3; i++ )
 			{
-				if( unpremult && alpha )
-				{
-					const float *A = &alpha->readable().front();
-					float *C = &rgb[i]->writable().front();
-					for( int j = 0; j < samples; j++ )
-					{
-						// Pixels with no alpha aren't touched by either the unpremult or repremult
-						if( *A != 0 )
-						{
-							*C *= *A;
-						}
-						A++;
-						C++;
-					}
-				}
+				premultiply( rgb[i].get(), alpha.get() );
 			}
 		}
 
@@ -340,6 +375,81 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	ImageProcessor::compute( output, context );
 }
 
+const ImagePlug *ColorProcessor::fusedInput( const Gaffer::Context *context, const std::string &layerName, const std::vector<std::string> &channelNames, bool unpremult, std::vector<ColorProcessorFunction> &upstreamProcessors ) const
+{
+	// Fusion is only valid if all of R, G and B exist. Otherwise an upstream
+	// processor sees zeroes for the missing channels, and its results for them
+	// are discarded rather than being passed on to us.
+	std::array<std::string, 3> rgbNames;
+	int i = 0;
+	for( const auto &baseName : { "R", "G", "B" } )
+	{
+		rgbNames[i] = ImageAlgo::channelName( layerName, baseName );
+		if( !ImageAlgo::channelExists( channelNames, rgbNames[i] ) )
+		{
+			return inPlug();
+		}
+		i++;
+	}
+
+	const ImagePlug *input = inPlug();
+	while( true )
+	{
+		const ImagePlug *source = input->source<ImagePlug>();
+		const ColorProcessor *upstream = runTimeCast<const ColorProcessor>( source->node() );
+		if( !upstream || source != upstream->outPlug() )
+		{
+			break;
+		}
+
+		bool upstreamEnabled;
+		ConstColorProcessorDataPtr upstreamData;
+		std::string upstreamChannels;
+		bool upstreamUnpremult = false;
+		{
+			ImagePlug::GlobalScope globalScope( context );
+			upstreamEnabled = upstream->enabled();
+			if( upstreamEnabled )
+			{
+				upstreamData = boost::static_pointer_cast<const ColorProcessorData>( upstream->colorProcessorPlug()->getValue() );
+				upstreamChannels = upstream->channelsPlug()->getValue();
+				upstreamUnpremult = upstream->processUnpremultipliedPlug()->getValue();
+			}
+		}
+
+		if( upstreamEnabled && upstreamData->colorProcessor )
+		{
+			// The upstream node must process all of R, G and B in the same
+			// way as we do, otherwise we can't fuse it.
+			if( upstreamUnpremult != unpremult )
+			{
+				break;
+			}
+			bool processesAll = true;
+			for( const auto &channelName : rgbNames )
+			{
+				if( !StringAlgo::matchMultiple( channelName, upstreamChannels ) || !upstream->channelEnabled( channelName ) )
+				{
+					processesAll = false;
+					break;
+				}
+			}
+			if( !processesAll )
+			{
+				break;
+			}
+			upstreamProcessors.push_back( upstreamData->colorProcessor );
+		}
+		// Otherwise the upstream node is a pass-through, and we can
+		// simply skip it.
+
+		input = upstream->inPlug();
+	}
+
+	std::reverse( upstreamProcessors.begin(), upstreamProcessors.end() );
+	return input;
+}
+
 Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer::ValuePlug *output ) const
 {
 	if( output == outPlug()->channelDataPlug() )
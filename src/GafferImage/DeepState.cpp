@@ -40,6 +40,11 @@
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/DeepState.h"
 
+#include "boost/noncopyable.hpp"
+
+#include <cstring>
+#include <memory>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -59,6 +64,150 @@ const IECore::InternedString g_contributionIdsName = "contributionIds";
 const IECore::InternedString g_contributionWeightsName = "contributionWeights";
 const IECore::InternedString g_contributionOffsetsName = "contributionOffsets";
 
+// Used by `computeSampleSorting()`. We sort entries with a single integer key
+// rather than sorting indices with a comparison function, because that requires
+// two indirect lookups into the Z and ZBack channels for every comparison.
+struct SortEntry
+{
+	uint64_t key;
+	int index;
+
+	bool operator < ( const SortEntry &rhs ) const
+	{
+		return key < rhs.key || ( key == rhs.key && index < rhs.index );
+	}
+};
+
+// Scratch memory used while computing the sample mapping. For images with many
+// samples per pixel, allocating these buffers afresh for every tile is a significant
+// cost, so we keep a small pool of them for reuse on each thread.
+struct Scratch
+{
+	std::vector<SortEntry> sortEntries;
+	// Z and ZBack reordered by the sample sorting, as input to SampleMerge.
+	std::vector<float> sortedZ;
+	std::vector<float> sortedZBack;
+	// Used by SampleMerge.
+	std::vector<int> openSamples;
+	FloatVectorDataPtr zData;
+	FloatVectorDataPtr zBackData;
+	IntVectorDataPtr sampleOffsetsData;
+	IntVectorDataPtr contributionIdsData;
+	FloatVectorDataPtr contributionAmountsData;
+	IntVectorDataPtr contributionOffsetsData;
+
+	// Drops references to any data that has been stored in a compute result,
+	// since it can't be reused, and we don't want to keep it alive after it
+	// is evicted from the cache.
+	void releaseShared()
+	{
+		auto release = [] ( auto &data ) {
+			if( data && data->refCount() > 1 )
+			{
+				data = nullptr;
+			}
+		};
+		release( zData );
+		release( zBackData );
+		release( sampleOffsetsData );
+		release( contributionIdsData );
+		release( contributionAmountsData );
+		release( contributionOffsetsData );
+	}
+
+	size_t memoryUsage() const
+	{
+		size_t result = sortEntries.capacity() * sizeof( SortEntry );
+		result += ( sortedZ.capacity() + sortedZBack.capacity() ) * sizeof( float );
+		result += openSamples.capacity() * sizeof( int );
+		auto dataMemory = [] ( const Data *d ) -> size_t {
+			return d ? d->memoryUsage() : 0;
+		};
+		result += dataMemory( zData.get() ) + dataMemory( zBackData.get() );
+		result += dataMemory( sampleOffsetsData.get() ) + dataMemory( contributionIdsData.get() );
+		result += dataMemory( contributionAmountsData.get() ) + dataMemory( contributionOffsetsData.get() );
+		return result;
+	}
+};
+
+// We rarely need more than one Scratch per thread, but the sample mapping for
+// one tile may be computed while waiting on another, so we allow for a few.
+const size_t g_maxPooledScratch = 4;
+// Limits the total size of the Scratch pooled by each thread. Scratch that
+// would exceed it is freed rather than pooled, so that unusually dense tiles
+// don't tie up memory indefinitely, outside the reach of the compute cache.
+const size_t g_maxPooledScratchMemory = 16 * 1024 * 1024;
+
+struct ScratchPool
+{
+	std::vector<std::unique_ptr<Scratch>> scratch;
+	size_t memoryUsage = 0;
+};
+
+thread_local ScratchPool g_scratchPool;
+
+// Acquires a Scratch from the pool for the current thread, returning it on destruction.
+class ScratchScope : boost::noncopyable
+{
+
+	public :
+
+		ScratchScope()
+		{
+			if( g_scratchPool.scratch.empty() )
+			{
+				m_scratch = std::make_unique<Scratch>();
+			}
+			else
+			{
+				m_scratch = std::move( g_scratchPool.scratch.back() );
+				g_scratchPool.scratch.pop_back();
+				// Scratch isn't modified while pooled, so this matches
+				// the amount added in `~ScratchScope()`.
+				g_scratchPool.memoryUsage -= m_scratch->memoryUsage();
+			}
+		}
+
+		~ScratchScope()
+		{
+			m_scratch->releaseShared();
+			const size_t memoryUsage = m_scratch->memoryUsage();
+			if(
+				g_scratchPool.scratch.size() < g_maxPooledScratch &&
+				g_scratchPool.memoryUsage + memoryUsage <= g_maxPooledScratchMemory
+			)
+			{
+				g_scratchPool.scratch.push_back( std::move( m_scratch ) );
+				g_scratchPool.memoryUsage += memoryUsage;
+			}
+		}
+
+		Scratch &scratch()
+		{
+			return *m_scratch;
+		}
+
+	private :
+
+		std::unique_ptr<Scratch> m_scratch;
+
+};
+
+// Returns `data` cleared ready for reuse, or new data if there is none to reuse.
+template<typename T>
+typename T::Ptr reuse( typename T::Ptr &data )
+{
+	if( !data )
+	{
+		data = new T;
+	}
+	else
+	{
+		data->writable().clear();
+	}
+	return data;
+}
+
 // This class stores all information about how samples are merged together.
 // It is initialized just based on the sorted Z and ZBack channels ( and the sampleOffsets that
 // map them ).  The outputs are stored in members, and include:
@@ -75,21 +224,24 @@ const IECore::InternedString g_contributionOffsetsName = "contributionOffsets";
 class SampleMerge
 {
 	public :
-		SampleMerge( const vector<int> &inSampleOffsets, const vector<float> *inZ, const vector<float> *inZBack )
-			:	zData( new FloatVectorData() ),
-				zBackData( new FloatVectorData() ),
-				sampleOffsetsData( new IntVectorData() ),
-				contributionIdsData( new IntVectorData() ),
-				contributionAmountsData( new FloatVectorData() ),
-				contributionOffsetsData( new IntVectorData() ),
+		SampleMerge( const vector<int> &inSampleOffsets, const vector<float> *inZ, const vector<float> *inZBack, Scratch &scratch )
+			:	zData( reuse<FloatVectorData>( scratch.zData ) ),
+				zBackData( reuse<FloatVectorData>( scratch.zBackData ) ),
+				sampleOffsetsData( reuse<IntVectorData>( scratch.sampleOffsetsData ) ),
+				contributionIdsData( reuse<IntVectorData>( scratch.contributionIdsData ) ),
+				contributionAmountsData( reuse<FloatVectorData>( scratch.contributionAmountsData ) ),
+				contributionOffsetsData( reuse<IntVectorData>( scratch.contributionOffsetsData ) ),
 				m_inZ( inZ ? *inZ : zData->writable() ),  // Unused when there is no inZ
 				m_inZBack( inZBack ? *inZBack : zBackData->writable() ),  // Unused when there is no inZ
+				m_openSamples( scratch.openSamples ),
 				m_zOut( zData->writable() ),
 				m_zBackOut( zBackData->writable() ),
 				m_contributionIdsOut( contributionIdsData->writable() ),
 				m_contributionAmountsOut( contributionAmountsData->writable() ),
 				m_contributionOffsetsOut( contributionOffsetsData->writable() )
 		{
+			m_openSamples.clear();
+
 			vector<int> &sampleOffsetsOut = sampleOffsetsData->writable();
 			sampleOffsetsOut.reserve( ImagePlug::tilePixels() );
 
@@ -267,7 +419,7 @@ class SampleMerge
 
 		const vector<float> &m_inZ;
 		const vector<float> &m_inZBack;
-		std::vector<int> m_openSamples;
+		std::vector<int> &m_openSamples;
 		vector<float> &m_zOut;
 		vector<float> &m_zBackOut;
 		vector<int> &m_contributionIdsOut;
@@ -640,6 +792,16 @@ IECore::ConstFloatVectorDataPtr sortByIndices( const std::vector<float> &input,
 	return resultData;
 }
 
+// As above, but writing into an existing vector.
+void sortByIndices( const std::vector<float> &input, const vector<int> &indices, std::vector<float> &result )
+{
+	result.resize( input.size() );
+	for( unsigned int i = 0; i < input.size(); i++ )
+	{
+		result[ i ] = input[ indices[ i ] ];
+	}
+}
+
 // Return a FloatVectorData which for each element of indices, contains the element of input with that index.
 IECore::ConstFloatVectorDataPtr sumByIndicesAndWeights( const std::vector<float> &input,
 	const vector<int> &indices,
@@ -698,40 +860,32 @@ IECore::ConstFloatVectorDataPtr sumByWeights( const std::vector<float> &input,
 	return resultData;
 }
 
-// Given the Z and ZBack channels, and corresponding sampleOffsets, return an IntVectorData
-// a list of sample indices that would produce sorted samples.
-IECore::IntVectorDataPtr computeSampleSorting(
-	const vector<int> &sampleOffsets, const vector<float> &z, const vector<float> &zBack
-)
+// Returns an integer that sorts in the same order as `v`. Positive floats already sort
+// correctly as integers once the sign bit is set, and negative floats sort correctly once
+// all their bits are flipped. -0 compares equal to 0, so is given the same key.
+inline uint32_t sortKey( float v )
 {
-	// We compare based on the Z channel - if it is equal, compare based on ZBack
-	struct CompareDepth
+	if( v == 0.0f )
 	{
-		const vector<float> &m_zSamples;
-		const vector<float> &m_zBackSamples;
-
-		CompareDepth( const vector<float> &zSamples, const vector<float> &zBackSamples )
-			: m_zSamples( zSamples ), m_zBackSamples( zBackSamples )
-		{}
+		return 0x80000000;
+	}
+	uint32_t i;
+	std::memcpy( &i, &v, sizeof( i ) );
+	return ( i & 0x80000000 ) ? ~i : i | 0x80000000;
+}
 
-		bool operator()( int a, int b ) const
-		{
-			if( m_zSamples[a] != m_zSamples[b] )
-			{
-				return m_zSamples[a] < m_zSamples[b];
-			}
-			else if( m_zBackSamples[a] != m_zBackSamples[b] )
-			{
-				return m_zBackSamples[a] < m_zBackSamples[b];
-			}
-			else
-			{
-				// If everything is equal, preserve initial order
-				return a < b;
-			}
-		}
-	};
+// Pixels with up to this many samples are sorted with an insertion sort, which
+// is faster than `std::sort()` for small counts, and is linear for samples that
+// are already nearly sorted.
+const int g_insertionSortThreshold = 16;
 
+// Given the Z and ZBack channels, and corresponding sampleOffsets, return an IntVectorData
+// a list of sample indices that would produce sorted samples. Samples are ordered by Z, then
+// ZBack, with ties preserving their original order.
+IECore::IntVectorDataPtr computeSampleSorting(
+	const vector<int> &sampleOffsets, const vector<float> &z, const vector<float> &zBack, Scratch &scratch
+)
+{
 	IntVectorDataPtr resultData = new IntVectorData();
 	std::vector<int> &result = resultData->writable();
 	result.resize( sampleOffsets.back() );
@@ -740,16 +894,48 @@ IECore::IntVectorDataPtr computeSampleSorting(
 		result[i] = i;
 	}
 
-	CompareDepth compare( z, zBack );
+	std::vector<SortEntry> &entries = scratch.sortEntries;
 
 	int prevOffset = 0;
 	for( int offset : sampleOffsets )
 	{
-		if( offset > prevOffset )
+		const int numSamples = offset - prevOffset;
+		if( numSamples > 1 )
 		{
-			std::sort( &result[prevOffset], &result[offset], compare );
-			prevOffset = offset;
+			entries.resize( numSamples );
+			for( int i = 0; i < numSamples; ++i )
+			{
+				const int index = prevOffset + i;
+				entries[i].key = ( uint64_t( sortKey( z[index] ) ) << 32 ) | sortKey( zBack[index] );
+				entries[i].index = index;
+			}
+
+			if( numSamples <= g_insertionSortThreshold )
+			{
+				// Entries start in index order, and the insertion sort is stable,
+				// so comparing keys alone is sufficient.
+				for( int i = 1; i < numSamples; ++i )
+				{
+					const SortEntry e = entries[i];
+					int j = i;
+					for( ; j > 0 && e.key < entries[j-1].key; --j )
+					{
+						entries[j] = entries[j-1];
+					}
+					entries[j] = e;
+				}
+			}
+			else
+			{
+				std::sort( entries.begin(), entries.end() );
+			}
+
+			for( int i = 0; i < numSamples; ++i )
+			{
+				result[prevOffset + i] = entries[i].index;
+			}
 		}
+		prevOffset = offset;
 	}
 
 	return resultData;
@@ -1064,6 +1250,8 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	}
 
 	IECore::IntVectorDataPtr sampleSortingData = nullptr;
+	ScratchScope scratchScope;
+	Scratch &scratch = scratchScope.scratch();
 
 	if( isTidy )
 	{
@@ -1110,7 +1298,7 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	if( !isSorted )
 	{
 		sampleSortingData = computeSampleSorting(
-				sampleOffsetsData->readable(), zData->readable(), zBackData->readable()
+				sampleOffsetsData->readable(), zData->readable(), zBackData->readable(), scratch
 			);
 	}
 
@@ -1124,24 +1312,27 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	}
 	else
 	{
+		const vector<float> *mergeZ = hasZ ? &zData->readable() : nullptr;
+		const vector<float> *mergeZBack = hasZ ? &zBackData->readable() : nullptr;
 		if( sampleSortingData )
 		{
 			// If the input is unsorted, we need to apply the sort to Z and ZBack before
 			// we can merge samples
-			zData = sortByIndices( zData->readable(), sampleSortingData->readable() );
+			sortByIndices( zData->readable(), sampleSortingData->readable(), scratch.sortedZ );
+			mergeZ = &scratch.sortedZ;
 			if( hasZBack )
 			{
-				zBackData = sortByIndices( zBackData->readable(), sampleSortingData->readable() );
+				sortByIndices( zBackData->readable(), sampleSortingData->readable(), scratch.sortedZBack );
+				mergeZBack = &scratch.sortedZBack;
 			}
 			else
 			{
-				zBackData = zData;
+				mergeZBack = mergeZ;
 			}
 		}
 
 		// Set up the sample merge data
-		SampleMerge sampleMerge( sampleOffsetsData->readable(),
-			hasZ ? &zData->readable() : nullptr, hasZ ? &zBackData->readable() : nullptr );
+		SampleMerge sampleMerge( sampleOffsetsData->readable(), mergeZ, mergeZBack, scratch );
 
 		if( sampleSortingData )
 		{
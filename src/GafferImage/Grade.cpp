@@ -262,23 +262,42 @@ void Grade::processChannelData( const Gaffer::Context *context, const ImagePlug
 	}
 	const float invGamma = 1. / gamma;
 
-	// Get some useful pointers.
-	float *outPtr = &(outData->writable()[0]);
-	const float *END = outPtr + outData->writable().size();
+	// The input has been copied to outData, so we operate in place. We
+	// do each step as a separate loop with the conditions hoisted out, so
+	// that the compiler can vectorise the common cases.
+	float *out = outData->writable().data();
+	const size_t size = outData->readable().size();
 
-	while (outPtr != END)
+	if( invGamma == 1.f )
 	{
-		// Calculate the colour of the graded pixel.
-		float colour = *outPtr;	// As the input has been copied to outData, grab the input colour from there.
-		const float c = A * colour + B;
-		colour = ( c >= 0.f && invGamma != 1.f ? (float)pow( c, invGamma ) : c );
-
-		// Clamp the white and blacks if necessary.
-		if ( blackClamp && colour < 0.f ) colour = 0.f;
-		if ( whiteClamp && colour > 1.f ) colour = 1.f;
+		for( size_t i = 0; i < size; ++i )
+		{
+			out[i] = A * out[i] + B;
+		}
+	}
+	else
+	{
+		for( size_t i = 0; i < size; ++i )
+		{
+			const float c = A * out[i] + B;
+			out[i] = c >= 0.f ? (float)pow( c, invGamma ) : c;
+		}
+	}
 
-		// Write back the result.
-		*outPtr++ = colour;
+	// Clamp the white and blacks if necessary.
+	if( blackClamp )
+	{
+		for( size_t i = 0; i < size; ++i )
+		{
+			out[i] = out[i] < 0.f ? 0.f : out[i];
+		}
+	}
+	if( whiteClamp )
+	{
+		for( size_t i = 0; i < size; ++i )
+		{
+			out[i] = out[i] > 1.f ? 1.f : out[i];
+		}
 	}
 }
 
@@ -274,9 +274,15 @@ void ImageNode::compute( ValuePlug *output, const Context *context ) const
 			{
 				throw Exception( "The image:tileOrigin must be a multiple of ImagePlug::tileSize()" );
 			}
-			static_cast<FloatVectorDataPlug *>( output )->setValue(
-				computeChannelData( channelName, tileOrigin, context, imagePlug )
-			);
+			ConstFloatVectorDataPtr channelData = computeChannelData( channelName, tileOrigin, context, imagePlug );
+			// Substitute uniform tiles with a shared constant tile, so that
+			// the cache doesn't store many copies of the same values.
+			float constantValue;
+			if( ImagePlug::isConstantTile( channelData.get(), constantValue ) )
+			{
+				channelData = ImagePlug::constantTile( constantValue );
+			}
+			static_cast<FloatVectorDataPlug *>( output )->setValue( channelData );
 		}
 		else
 		{
@@ -45,6 +45,9 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include <cstring>
 
 using namespace std;
 using namespace tbb;
@@ -65,6 +68,51 @@ const IECore::InternedString ImagePlug::tileOriginContextName = "image:tileOrigi
 
 const std::string ImagePlug::defaultViewName = "default";
 
+namespace
+{
+
+// A flat tile where every pixel has the same value. Such tiles are shared
+// between all users, and the type allows `isConstantTile()` to identify them
+// without checking every value. Note that we don't declare a new TypeId, so
+// that the tiles are indistinguishable from regular FloatVectorData, and
+// copies are regular FloatVectorData. Memory usage is reported in full, since
+// a tile may be the only user of its storage.
+class ConstantTileData : public IECore::FloatVectorData
+{
+
+	public :
+
+		explicit ConstantTileData( float value )
+			:	FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), value ) )
+		{
+		}
+
+};
+
+uint32_t floatBits( float value )
+{
+	uint32_t result;
+	std::memcpy( &result, &value, sizeof( float ) );
+	return result;
+}
+
+using ConstantTileCache = IECorePreview::LRUCache<uint32_t, ConstFloatVectorDataPtr, IECorePreview::LRUCachePolicy::Parallel>;
+ConstantTileCache g_constantTileCache(
+	[] ( uint32_t bits, size_t &cost, const IECore::Canceller *canceller ) -> ConstFloatVectorDataPtr {
+		float value;
+		std::memcpy( &value, &bits, sizeof( float ) );
+		ConstFloatVectorDataPtr result = new ConstantTileData( value );
+		cost = result->memoryUsage();
+		return result;
+	},
+	// Tiles evicted from here remain valid for as long as they are
+	// referenced elsewhere, so this just limits the potential for
+	// sharing.
+	16 * 1024 * 1024
+);
+
+} // namespace
+
 static ContextAlgo::GlobalScope::Registration g_globalScopeRegistration(
 	ImagePlug::staticTypeId(),
 	{ ImagePlug::channelNameContextName, ImagePlug::tileOriginContextName }
@@ -190,16 +238,59 @@ const IECore::FloatVectorData *ImagePlug::emptyTile()
 
 const IECore::FloatVectorData *ImagePlug::whiteTile()
 {
-	static IECore::ConstFloatVectorDataPtr g_whiteTile( new IECore::FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), 1. ) ) );
+	static IECore::ConstFloatVectorDataPtr g_whiteTile( new ConstantTileData( 1.0f ) );
 	return g_whiteTile.get();
 };
 
 const IECore::FloatVectorData *ImagePlug::blackTile()
 {
-	static IECore::ConstFloatVectorDataPtr g_blackTile( new IECore::FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), 0. ) ) );
+	static IECore::ConstFloatVectorDataPtr g_blackTile( new ConstantTileData( 0.0f ) );
 	return g_blackTile.get();
 };
 
+IECore::ConstFloatVectorDataPtr ImagePlug::constantTile( float value )
+{
+	const uint32_t bits = floatBits( value );
+	if( bits == floatBits( 0.0f ) )
+	{
+		return blackTile();
+	}
+	else if( bits == floatBits( 1.0f ) )
+	{
+		return whiteTile();
+	}
+	return g_constantTileCache.get( bits );
+}
+
+bool ImagePlug::isConstantTile( const IECore::FloatVectorData *tile, float &value )
+{
+	const std::vector<float> &pixels = tile->readable();
+	if( pixels.size() != (size_t)tilePixels() )
+	{
+		return false;
+	}
+
+	if( dynamic_cast<const ConstantTileData *>( tile ) )
+	{
+		value = pixels[0];
+		return true;
+	}
+
+	// Compare bitwise, so that we distinguish between 0 and -0,
+	// and treat NaNs consistently.
+	const uint32_t bits = floatBits( pixels[0] );
+	for( float v : pixels )
+	{
+		if( floatBits( v ) != bits )
+		{
+			return false;
+		}
+	}
+
+	value = pixels[0];
+	return true;
+}
+
 bool ImagePlug::acceptsChild( const GraphComponent *potentialChild ) const
 {
 	if( !ValuePlug::acceptsChild( potentialChild ) )
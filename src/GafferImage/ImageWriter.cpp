@@ -71,8 +71,13 @@
 
 #include "fmt/format.h"
 
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #ifndef _MSC_VER
 #include <sys/utsname.h>
@@ -169,6 +174,146 @@ void copyDeepArea(
 
 using ImageOutputPtr = std::shared_ptr<ImageOutput>;
 
+// The maximum amount of data held in a WriteBehindQueue before `push()` blocks.
+const size_t g_writeBehindMemoryLimit = 256 * 1024 * 1024;
+
+// Performs writes to an ImageOutput on a dedicated thread, so that compression
+// and file output don't hold up the gathering of tiles. Writes are performed
+// in the order they are pushed, and the queue is bounded so that memory usage
+// is limited when computation outpaces writing. Errors from failed writes are
+// rethrown by the next call to `push()`, `flush()` or `close()`.
+class WriteBehindQueue
+{
+
+	public :
+
+		WriteBehindQueue( ImageOutputPtr out )
+			:	m_out( out ), m_queuedBytes( 0 ), m_writing( false ), m_abort( false ), m_thread( [this] { run(); } )
+		{
+		}
+
+		~WriteBehindQueue()
+		{
+			// If we get here without `close()` having been called, it is because
+			// an exception is propagating, so we abandon any pending writes.
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_abort = true;
+			}
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+		const ImageOutputPtr &out() const
+		{
+			return m_out;
+		}
+
+		// Queues `write` to be performed on the write thread, blocking if `bytes`
+		// would take the queue over its memory limit. `write` should hold
+		// ownership of the data it writes.
+		void push( std::function<void ()> &&write, size_t bytes )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			// We always accept at least one write, so that writes larger
+			// than the limit can't block forever.
+			m_condition.wait(
+				lock, [&] { return m_exception || m_queue.empty() || m_queuedBytes + bytes <= g_writeBehindMemoryLimit; }
+			);
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
+			m_queue.push_back( { std::move( write ), bytes } );
+			m_queuedBytes += bytes;
+			lock.unlock();
+			m_condition.notify_all();
+		}
+
+		// Waits for all pending writes to complete. Must be called before
+		// using `out()` directly.
+		void flush()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_condition.wait( lock, [&] { return m_exception || ( m_queue.empty() && !m_writing ); } );
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
+		}
+
+		// Completes all pending writes and closes the file.
+		void close()
+		{
+			push( [out = m_out] { out->close(); }, 0 );
+			flush();
+		}
+
+	private :
+
+		void run()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				m_condition.wait( lock, [&] { return m_abort || !m_queue.empty(); } );
+				if( m_abort )
+				{
+					return;
+				}
+
+				Write write = std::move( m_queue.front() );
+				m_queue.pop_front();
+				m_writing = true;
+				lock.unlock();
+
+				std::exception_ptr exception;
+				try
+				{
+					write.function();
+				}
+				catch( ... )
+				{
+					exception = std::current_exception();
+				}
+				// Release the data before we reacquire the lock.
+				write.function = nullptr;
+
+				lock.lock();
+				m_writing = false;
+				m_queuedBytes -= write.bytes;
+				if( exception && !m_exception )
+				{
+					m_exception = exception;
+					m_queue.clear();
+					m_queuedBytes = 0;
+				}
+				m_condition.notify_all();
+			}
+		}
+
+		struct Write
+		{
+			std::function<void ()> function;
+			size_t bytes;
+		};
+
+		ImageOutputPtr m_out;
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<Write> m_queue;
+		size_t m_queuedBytes;
+		bool m_writing;
+		bool m_abort;
+		std::exception_ptr m_exception;
+
+		// Declared last, so that the thread is started after all
+		// other members are initialised.
+		std::thread m_thread;
+
+};
+
 class TileSampleOffsetsProcessor
 {
 	public:
@@ -281,15 +426,18 @@ class FlatTileWriter
 	// black, which is what we want. So iterate over the remaining tiles, and
 	// if memory has been allocated for that tile, write it to the file, and if
 	// nothing has been allocated, write a black tile.
+	//
+	// The writes themselves are performed asynchronously by a WriteBehindQueue.
 	public:
 		FlatTileWriter(
-				ImageOutputPtr out,
+				WriteBehindQueue &writeQueue,
 				const std::string &fileName,
 				const Imath::Box2i &processWindow,
 				const GafferImage::Format &format,
 				const std::vector< std::string > &channels
 			) :
-				m_out( out ),
+				m_writeQueue( writeQueue ),
+				m_out( writeQueue.out() ),
 				m_fileName( fileName ),
 				m_format( format ),
 				m_channels( channels ),
@@ -463,12 +611,19 @@ class FlatTileWriter
 		{
 			Imath::V2i exrTileOrigin = m_format.toEXRSpace( tileOrigin + Imath::V2i( 0, m_spec.tile_height - 1 ) );
 
-			if( !m_out->write_tile( exrTileOrigin.x, exrTileOrigin.y, 0, TypeDesc::FLOAT, &tileData->readable()[0] ) )
-			{
-				throw IECore::Exception( fmt::format( "Could not write tile to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
-			}
+			const size_t bytes = tileData->readable().size() * sizeof( float );
+			m_writeQueue.push(
+				[out = m_out, fileName = m_fileName, exrTileOrigin, tileData = std::move( tileData )] {
+					if( !out->write_tile( exrTileOrigin.x, exrTileOrigin.y, 0, TypeDesc::FLOAT, &tileData->readable()[0] ) )
+					{
+						throw IECore::Exception( fmt::format( "Could not write tile to \"{}\", error = {}", fileName, out->geterror() ) );
+					}
+				},
+				bytes
+			);
 		}
 
+		WriteBehindQueue &m_writeQueue;
 		ImageOutputPtr m_out;
 		const std::string &m_fileName;
 		const GafferImage::Format &m_format;
@@ -496,17 +651,18 @@ class FlatScanlineWriter
 	// It stores a vector of floats big enough to hold ImagePlug::tileSize()
 	// scanlines. As it receives each tile, it copies the data into the
 	// appropriate location in the buffer. When it's copied the last channel
-	// of the last tile of each row, it writes all of the data from the buffer
-	// into the ImageOutput object.
+	// of the last tile of each row, it hands the buffer over to a WriteBehindQueue
+	// to be written to the ImageOutput object asynchronously, and starts a new one.
 	public:
 		FlatScanlineWriter(
-				ImageOutputPtr out,
+				WriteBehindQueue &writeQueue,
 				const std::string &fileName,
 				const Imath::Box2i &processWindow,
 				const GafferImage::Format &format,
 				const std::vector< std::string > &channels
 			) :
-				m_out( out ),
+				m_writeQueue( writeQueue ),
+				m_out( writeQueue.out() ),
 				m_fileName( fileName ),
 				m_format( format ),
 				m_channels( channels ),
@@ -575,12 +731,24 @@ class FlatScanlineWriter
 			return channelIndex == ( m_channels.size() - 1 ) && tileOrigin.x == ( m_tilesBounds.max.x - ImagePlug::tileSize() ) ;
 		}
 
-		void writeScanlines( const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 ) const
+		void writeScanlines( const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 )
 		{
-			if ( !m_out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, &m_scanlinesData[0] + ( scanlinesYOffset * m_spec.width * m_channels.size() ) ) )
-			{
-				throw IECore::Exception( fmt::format( "Could not write scanline to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
-			}
+			// Hand our buffer over to the write queue, and start a fresh one for
+			// the next scanlines.
+			const size_t size = m_scanlinesData.size();
+			auto scanlinesData = std::make_shared<vector<float>>( std::move( m_scanlinesData ) );
+			m_scanlinesData.assign( size, 0.0 );
+
+			const size_t offset = scanlinesYOffset * m_spec.width * m_channels.size();
+			m_writeQueue.push(
+				[out = m_out, fileName = m_fileName, exrYBegin, exrYEnd, offset, scanlinesData] {
+					if ( !out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, scanlinesData->data() + offset ) )
+					{
+						throw IECore::Exception( fmt::format( "Could not write scanline to \"{}\", error = {}", fileName, out->geterror() ) );
+					}
+				},
+				size * sizeof( float )
+			);
 		}
 
 		void writeBlankScanlines( int yBegin, int yEnd )
@@ -612,6 +780,7 @@ class FlatScanlineWriter
 			}
 		}
 
+		WriteBehindQueue &m_writeQueue;
 		ImageOutputPtr m_out;
 		const std::string &m_fileName;
 		const GafferImage::Format &m_format;
@@ -1551,6 +1720,21 @@ MetadataRegistration g_metadataRegistration;
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// ImageWriter::WriteHandle
+//////////////////////////////////////////////////////////////////////////
+
+// The handle returned by `startWrite()` is just the WriteBehindQueue that is
+// performing the writes.
+class ImageWriter::WriteHandle : public WriteBehindQueue
+{
+
+	public :
+
+		using WriteBehindQueue::WriteBehindQueue;
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // ImageWriter implementation
 //////////////////////////////////////////////////////////////////////////
@@ -1872,6 +2056,66 @@ IECore::MurmurHash ImageWriter::hash( const Context *context ) const
 }
 
 void ImageWriter::execute() const
+{
+	startWrite()->close();
+}
+
+void ImageWriter::executeSequence( const std::vector<float> &frames ) const
+{
+	// We don't wait for the writes for one frame to complete before
+	// starting on the next, so that the compression and file output
+	// for one frame overlap with the computation of the next.
+	Context::EditableScope timeScope( Context::current() );
+	std::shared_ptr<WriteHandle> currentWrite;
+	std::string currentFileName;
+	try
+	{
+		for( float frame : frames )
+		{
+			timeScope.setFrame( frame );
+			const std::string fileName = fileNamePlug()->getValue();
+			if( currentWrite && fileName == currentFileName )
+			{
+				// We can't have two ImageOutputs open on the same file, so
+				// must finish the previous frame before starting this one.
+				currentWrite->close();
+				currentWrite.reset();
+			}
+
+			std::shared_ptr<WriteHandle> previousWrite = currentWrite;
+			currentWrite = startWrite();
+			currentFileName = fileName;
+			if( previousWrite )
+			{
+				previousWrite->close();
+			}
+		}
+	}
+	catch( ... )
+	{
+		// Complete the writes that are already underway, rather than leaving
+		// a truncated file behind. Any error from doing so is secondary to
+		// the one we are already handling.
+		if( currentWrite )
+		{
+			try
+			{
+				currentWrite->close();
+			}
+			catch( ... )
+			{
+			}
+		}
+		throw;
+	}
+
+	if( currentWrite )
+	{
+		currentWrite->close();
+	}
+}
+
+std::shared_ptr<ImageWriter::WriteHandle> ImageWriter::startWrite() const
 {
 	// Create an OIIO::ImageOutput
 
@@ -2172,10 +2416,13 @@ void ImageWriter::execute() const
 		throw IECore::Exception( fmt::format( "Could not open \"{}\", error = {}", fileName, out->geterror() ) );
 	}
 
+	auto writeQueue = std::make_shared<WriteHandle>( out );
+
 	for( const Part &part : parts )
 	{
 		if( &part != &parts.front() )
 		{
+			writeQueue->flush();
 			out->open( fileName, part.spec, ImageOutput::AppendSubimage );
 		}
 
@@ -2190,13 +2437,13 @@ void ImageWriter::execute() const
 
 			if ( part.spec.tile_width == 0 )
 			{
-				FlatScanlineWriter flatScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
+				FlatScanlineWriter flatScanlineWriter( *writeQueue, fileName, part.processDataWindow, part.imageFormat, part.channels );
 				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
 				flatScanlineWriter.finish();
 			}
 			else
 			{
-				FlatTileWriter flatTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
+				FlatTileWriter flatTileWriter( *writeQueue, fileName, part.processDataWindow, part.imageFormat, part.channels );
 				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
 				flatTileWriter.finish();
 			}
@@ -2204,6 +2451,9 @@ void ImageWriter::execute() const
 		}
 		else
 		{
+			// The deep writers write to `out` directly.
+			writeQueue->flush();
+
 			TileSampleOffsetsProcessor sampleOffsetsProcessor;
 
 			SampleOffsetsAccumulator sampleOffsetsAccumulator;
@@ -2227,5 +2477,5 @@ void ImageWriter::execute() const
 		}
 	}
 
-	out->close();
+	return writeQueue;
 }
@@ -44,6 +44,8 @@
 #include "IECore/BoxOps.h"
 
 #include "fmt/format.h"
+
+#include <cstdint>
 #include <limits>
 
 using namespace std;
@@ -148,16 +150,14 @@ struct OpDifference
 {
 	static float operate( float A, float B, float a, float b)
 	{
-		if( memcmp( &A, &B, 4 ) == 0 )
-		{
-			return 0.0f;
-		}
-		float ret = fabs( A - B );
-		if( std::isnan( ret ) )
-		{
-			ret = std::numeric_limits<float>::infinity();
-		}
-		return ret;
+		// Written without branches so that the loops in `operateInside*()`
+		// can be vectorised. Identical values (including infinities and NaNs)
+		// give 0, and any other NaN result is converted to infinity.
+		uint32_t bitsA, bitsB;
+		memcpy( &bitsA, &A, 4 );
+		memcpy( &bitsB, &B, 4 );
+		const float ret = std::abs( A - B );
+		return bitsA == bitsB ? 0.0f : ( std::isnan( ret ) ? std::numeric_limits<float>::infinity() : ret );
 	}
 	static const SingleInputMode onlyA = Operate;
 	static const SingleInputMode onlyB = Operate;
@@ -303,6 +303,51 @@ inline MergeRegion tileRegion( int i, const Box2i &boundA, const Box2i &boundB,
 	return (MergeRegion)(( InsideA * inA ) | ( InsideB * inB ));
 }
 
+// Kernels applying an Op to a contiguous run of pixels. These are deliberately
+// written as simple indexed loops with a single output per loop, so that the
+// compiler is able to vectorise them. Colour must be computed before alpha
+// because when we are accumulating into the merge buffers, `R` and `r` alias
+// `B` and `b`, and the colour operation still needs the original `b`.
+
+template< class Op >
+void operateInsideBoth( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	for( int j = 0; j < length; ++j )
+	{
+		R[j] = Op::operate( A[j], B[j], a[j], b[j] );
+	}
+	for( int j = 0; j < length; ++j )
+	{
+		r[j] = Op::operate( a[j], b[j], a[j], b[j] );
+	}
+}
+
+template< class Op >
+void operateInsideA( const float *A, const float *a, float *R, float *r, int length )
+{
+	for( int j = 0; j < length; ++j )
+	{
+		R[j] = Op::operate( A[j], 0.0f, a[j], 0.0f );
+	}
+	for( int j = 0; j < length; ++j )
+	{
+		r[j] = Op::operate( a[j], 0.0f, a[j], 0.0f );
+	}
+}
+
+template< class Op >
+void operateInsideB( const float *B, const float *b, float *R, float *r, int length )
+{
+	for( int j = 0; j < length; ++j )
+	{
+		R[j] = Op::operate( 0.0f, B[j], 0.0f, b[j] );
+	}
+	for( int j = 0; j < length; ++j )
+	{
+		r[j] = Op::operate( 0.0f, b[j], 0.0f, b[j] );
+	}
+}
+
 struct MergeFunctor
 {
 	using ReturnType = void;
@@ -459,14 +504,10 @@ struct MergeFunctor
 				else
 				{
 					// Outside A dataWindow, so call operator with 0 substituted for A and a
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( 0.0f, *B, 0.0f, *b );
-						*r = Op::operate( 0.0f, *b, 0.0f, *b );
-						++B; ++b;
-						++R; ++r;
-					}
+					operateInsideB<Op>( B, b, R, r, length );
 					A += length; a += length;
+					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else if( region == InsideA )
@@ -484,27 +525,19 @@ struct MergeFunctor
 				else
 				{
 					// Outside B dataWindow, so call operator with 0 substituted for B and b
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( *A, 0.0f, *a, 0.0f );
-						*r = Op::operate( *a, 0.0f, *a, 0.0f );
-						++A; ++a;
-						++R; ++r;
-					}
+					operateInsideA<Op>( A, a, R, r, length );
+					A += length; a += length;
 					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else
 			{
 				// Within both data windows, this is when we actually need to run the full operate()
-				for( int j = 0; j < length; j++ )
-				{
-					*R = Op::operate( *A, *B, *a, *b );
-					*r = Op::operate( *a, *b, *a, *b );
-					++A; ++a;
-					++B; ++b;
-					++R; ++r;
-				}
+				operateInsideBoth<Op>( A, B, a, b, R, r, length );
+				A += length; a += length;
+				B += length; b += length;
+				R += length; r += length;
 			}
 			i += length;
 		}
@@ -63,7 +63,17 @@
 #include "tbb/parallel_for.h"
 #include "tbb/enumerable_thread_specific.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
 
 using namespace std;
 using namespace boost::placeholders;
@@ -115,6 +125,131 @@ void podVectorResizeUninitialized( std::vector<T> &v, size_t s )
 const IECore::InternedString g_tileBatchOriginContextName( "__tileBatchOrigin" );
 const IECore::InternedString g_noView( "" );
 
+// Tile batches may be stored in the persistent cache by setting
+// `GAFFERIMAGE_OPENIMAGEIOREADER_TILEBATCH_CACHEPOLICY=Persistent`, so
+// that decoded tiles can be shared with other processes on the same host.
+// The LocalDispatcher does this for its background processes when its
+// `sharedComputeCache` plug is on.
+ValuePlug::CachePolicy tileBatchCachePolicyFromEnv()
+{
+	const char *name = "GAFFERIMAGE_OPENIMAGEIOREADER_TILEBATCH_CACHEPOLICY";
+	if( const char *cp = getenv( name ) )
+	{
+		if( !strcmp( cp, "Persistent" ) )
+		{
+			return ValuePlug::CachePolicy::Persistent;
+		}
+		else if( strcmp( cp, "TaskCollaboration" ) )
+		{
+			IECore::msg(
+				IECore::Msg::Warning, "OpenImageIOReader",
+				fmt::format( "Invalid value \"{}\" for {}. Must be TaskCollaboration or Persistent.", cp, name )
+			);
+		}
+	}
+
+	return ValuePlug::CachePolicy::TaskCollaboration;
+}
+
+const ValuePlug::CachePolicy g_tileBatchCachePolicy = tileBatchCachePolicyFromEnv();
+
+// Prefetching
+// ===========
+//
+// When tiles are requested in a predictable order, as they are by
+// `ImageAlgo::parallelGatherTiles()` or a Viewer panning across an image, we
+// can read upcoming tile batches before they are requested. This overlaps file
+// I/O with the processing of previous tiles, which is particularly beneficial
+// when reading from network storage. Prefetching is disabled when the memory
+// limit is zero, which is the default unless a limit in megabytes is provided
+// by the `GAFFERIMAGE_OPENIMAGEIOREADER_PREFETCH_MEMORY_LIMIT` environment
+// variable.
+
+size_t prefetchMemoryLimitFromEnv()
+{
+	const char *name = "GAFFERIMAGE_OPENIMAGEIOREADER_PREFETCH_MEMORY_LIMIT";
+	if( const char *limit = getenv( name ) )
+	{
+		char *end = nullptr;
+		const long long megabytes = strtoll( limit, &end, 10 );
+		if( end != limit && *end == '\0' && megabytes >= 0 )
+		{
+			return megabytes * 1024 * 1024;
+		}
+		IECore::msg(
+			IECore::Msg::Warning, "OpenImageIOReader",
+			fmt::format( "Invalid value \"{}\" for {}. Must be a number of megabytes.", limit, name )
+		);
+	}
+
+	return 0;
+}
+
+std::atomic<size_t> g_prefetchMemoryLimit( prefetchMemoryLimitFromEnv() );
+std::atomic<size_t> g_prefetchMemoryUsage( 0 );
+
+// Totals for `prefetchedTileBatches()` and `usedPrefetchedTileBatches()`.
+std::atomic<size_t> g_prefetchedTileBatches( 0 );
+std::atomic<size_t> g_usedPrefetchedTileBatches( 0 );
+
+// The maximum number of tile batches to read ahead of the current request.
+const int g_prefetchLookahead = 4;
+const int g_prefetchThreads = 4;
+// The number of recently requested tile batches remembered by each file, so
+// that we don't prefetch batches which are probably still in the compute cache.
+const size_t g_maxRequestedTileBatches = 1024;
+
+// A small pool of threads dedicated to prefetching. We don't use TBB for this,
+// because the threads waiting for prefetches to complete are usually TBB
+// workers, and we don't want the prefetches to depend on them to make progress.
+class PrefetchThreadPool
+{
+
+	public :
+
+		static void enqueue( std::function<void ()> &&task )
+		{
+			// Deliberately leaked, along with the threads, to avoid problems
+			// with destruction order at shutdown.
+			static PrefetchThreadPool *g_pool = new PrefetchThreadPool;
+			{
+				std::lock_guard<std::mutex> lock( g_pool->m_mutex );
+				g_pool->m_tasks.push_back( std::move( task ) );
+			}
+			g_pool->m_condition.notify_one();
+		}
+
+	private :
+
+		PrefetchThreadPool()
+		{
+			for( int i = 0; i < g_prefetchThreads; ++i )
+			{
+				std::thread( [this] { run(); } ).detach();
+			}
+		}
+
+		void run()
+		{
+			while( true )
+			{
+				std::function<void ()> task;
+				{
+					std::unique_lock<std::mutex> lock( m_mutex );
+					m_condition.wait( lock, [this] { return !m_tasks.empty(); } );
+					task = std::move( m_tasks.front() );
+					m_tasks.pop_front();
+				}
+				task();
+			}
+		}
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<std::function<void ()>> m_tasks;
+
+};
+
 const std::string g_oiioCompression( "compression" );
 
 struct ChannelMapEntry
@@ -735,7 +870,10 @@ Box2i expandToGrid( Box2i region, V2i gridOrigin, V2i gridSize )
 // Tile batches are selected using V3i "tileBatchOrigin".  The Z component is the subimage to load channels from.
 // The X and Y components are the pixel coordinates of the origin of the first tile.
 //
-class File
+// When prefetching is enabled, `tileBatch()` also tracks the order in which batches are requested, and
+// reads the batches it expects to be requested next on the PrefetchThreadPool.
+//
+class File : public std::enable_shared_from_this<File>
 {
 
 	public:
@@ -969,6 +1107,68 @@ class File
 			}
 		}
 
+		~File()
+		{
+			for( const auto &[key, prefetch] : m_prefetches )
+			{
+				g_prefetchMemoryUsage -= prefetch.cost;
+			}
+		}
+
+		// Returns the tile batch to be stored on the tile batch plug. This is equivalent to `readTileBatch()`,
+		// but uses the result of a prefetch if one is available, and then starts prefetching the batches we
+		// expect to be requested next.
+		ConstObjectVectorPtr tileBatch( const Context *c, V3i tileBatchOrigin )
+		{
+			if( !g_prefetchMemoryLimit )
+			{
+				return readTileBatch( c, tileBatchOrigin );
+			}
+
+			const View &view = lookupView( c );
+			const TileBatchKey key( &view, tileBatchOrigin.x, tileBatchOrigin.y, tileBatchOrigin.z );
+
+			std::shared_future<ConstObjectVectorPtr> prefetched;
+			{
+				std::lock_guard<std::mutex> lock( m_prefetchMutex );
+				if( m_requestedTileBatches.insert( key ).second )
+				{
+					m_requestedTileBatchOrder.push_back( key );
+					if( m_requestedTileBatchOrder.size() > g_maxRequestedTileBatches )
+					{
+						m_requestedTileBatches.erase( m_requestedTileBatchOrder.front() );
+						m_requestedTileBatchOrder.pop_front();
+					}
+				}
+
+				auto it = m_prefetches.find( key );
+				if( it != m_prefetches.end() )
+				{
+					prefetched = it->second.tileBatch;
+					g_prefetchMemoryUsage -= it->second.cost;
+					m_prefetches.erase( it );
+					g_usedPrefetchedTileBatches++;
+				}
+
+				prefetchTileBatches( c->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName ), view, tileBatchOrigin );
+			}
+
+			if( prefetched.valid() )
+			{
+				try
+				{
+					return prefetched.get();
+				}
+				catch( ... )
+				{
+					// Fall through to read the batch again, so that the error is
+					// reported by the process that actually needs the batch.
+				}
+			}
+
+			return readTileBatch( c, tileBatchOrigin );
+		}
+
 		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
 		ConstObjectVectorPtr readTileBatch( const Context *c, V3i tileBatchOrigin )
 		{
@@ -1555,6 +1755,100 @@ class File
 			return channelIndex * tilePlaneSize + subXY.y * view.tileBatchSize.x + subXY.x;
 		}
 
+		using TileBatchKey = std::tuple<const View *, int, int, int>;
+
+		// Must be called with `m_prefetchMutex` held. Compares `tileBatchOrigin` with the previous request
+		// for the same subimage, and if they are adjacent, prefetches the next batches in the same direction.
+		void prefetchTileBatches( const std::string &viewName, const View &view, const V3i &tileBatchOrigin )
+		{
+			auto [lastIt, inserted] = m_lastRequestedTileBatches.try_emplace( std::make_pair( &view, tileBatchOrigin.z ), tileBatchOrigin );
+			if( inserted )
+			{
+				return;
+			}
+
+			const V3i delta = tileBatchOrigin - lastIt->second;
+			lastIt->second = tileBatchOrigin;
+			if( ( delta.x != 0 ) == ( delta.y != 0 ) )
+			{
+				// Either a repeated request, or not a movement along a row or column.
+				return;
+			}
+
+			const V2i batchSize = view.tileBatchSize * ImagePlug::tileSize();
+			const V2i step( delta.x > 0 ? batchSize.x : ( delta.x < 0 ? -batchSize.x : 0 ), delta.y > 0 ? batchSize.y : ( delta.y < 0 ? -batchSize.y : 0 ) );
+
+			const V2i fileDataOrigin( view.imageSpec.x, view.imageSpec.y );
+			const Box2i dataWindow = flopDisplayWindow(
+				Box2i( fileDataOrigin, fileDataOrigin + V2i( view.imageSpec.width, view.imageSpec.height ) ),
+				view.imageSpec
+			);
+
+			size_t cost = 0;
+			for( int i = 1; i <= g_prefetchLookahead; ++i )
+			{
+				const V3i origin( tileBatchOrigin.x + step.x * i, tileBatchOrigin.y + step.y * i, tileBatchOrigin.z );
+				const V2i originXY( origin.x, origin.y );
+				if( !BufferAlgo::intersects( dataWindow, Box2i( originXY, originXY + batchSize ) ) )
+				{
+					break;
+				}
+
+				const TileBatchKey key( &view, origin.x, origin.y, origin.z );
+				if( m_requestedTileBatches.count( key ) || m_prefetches.count( key ) )
+				{
+					continue;
+				}
+
+				if( !cost )
+				{
+					// An estimate, since we don't know the size of deep batches until we've read them.
+					cost = m_imageInput->spec( origin.z, 0 ).nchannels * view.tileBatchSize.x * view.tileBatchSize.y * ImagePlug::tilePixels() * sizeof( float );
+				}
+
+				if( g_prefetchMemoryUsage + cost > g_prefetchMemoryLimit )
+				{
+					discardCompletedPrefetches();
+					if( g_prefetchMemoryUsage + cost > g_prefetchMemoryLimit )
+					{
+						break;
+					}
+				}
+
+				auto task = std::make_shared<std::packaged_task<ConstObjectVectorPtr ()>>(
+					[file = shared_from_this(), viewName, origin] {
+						ContextPtr context = new Context;
+						context->set( ImagePlug::viewNameContextName, viewName );
+						return file->readTileBatch( context.get(), origin );
+					}
+				);
+
+				g_prefetchMemoryUsage += cost;
+				g_prefetchedTileBatches++;
+				m_prefetches[key] = { task->get_future().share(), cost };
+				PrefetchThreadPool::enqueue( [task] { (*task)(); } );
+			}
+		}
+
+		// Must be called with `m_prefetchMutex` held. Discards prefetches which have completed but not yet
+		// been requested, to make room for new ones. These are typically left behind when the order of requests
+		// changes, for instance when a Viewer starts panning in a different direction.
+		void discardCompletedPrefetches()
+		{
+			for( auto it = m_prefetches.begin(); it != m_prefetches.end(); )
+			{
+				if( it->second.tileBatch.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready )
+				{
+					g_prefetchMemoryUsage -= it->second.cost;
+					it = m_prefetches.erase( it );
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
 		inline const View &lookupView( const Context *c ) const
 		{
 			std::string viewName = c->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName );
@@ -1606,6 +1900,20 @@ class File
 		std::string m_filePath;
 		StringVectorDataPtr m_viewNamesData;
 		std::map<std::string, std::unique_ptr< View > > m_views;
+
+		struct Prefetch
+		{
+			std::shared_future<ConstObjectVectorPtr> tileBatch;
+			size_t cost;
+		};
+
+		std::mutex m_prefetchMutex;
+		std::map<TileBatchKey, Prefetch> m_prefetches;
+		// Bounded to the last `g_maxRequestedTileBatches` requests, with
+		// `m_requestedTileBatchOrder` holding them in the order they were made.
+		std::set<TileBatchKey> m_requestedTileBatches;
+		std::deque<TileBatchKey> m_requestedTileBatchOrder;
+		std::map<std::pair<const View *, int>, V3i> m_lastRequestedTileBatches;
 };
 
 using FilePtr = std::shared_ptr<File>;
@@ -1794,6 +2102,26 @@ size_t OpenImageIOReader::getOpenFilesLimit()
 	return fileCache()->getMaxCost();
 }
 
+void OpenImageIOReader::setPrefetchMemoryLimit( size_t bytes )
+{
+	g_prefetchMemoryLimit = bytes;
+}
+
+size_t OpenImageIOReader::getPrefetchMemoryLimit()
+{
+	return g_prefetchMemoryLimit;
+}
+
+size_t OpenImageIOReader::prefetchedTileBatches()
+{
+	return g_prefetchedTileBatches;
+}
+
+size_t OpenImageIOReader::usedPrefetchedTileBatches()
+{
+	return g_usedPrefetchedTileBatches;
+}
+
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	std::string attr;
@@ -1942,7 +2270,7 @@ void OpenImageIOReader::compute( ValuePlug *output, const Context *context ) con
 		}
 
 		static_cast<ObjectVectorPlug *>( output )->setValue(
-			file->readTileBatch( context, tileBatchOrigin )
+			file->tileBatch( context, tileBatchOrigin )
 		);
 	}
 	else
@@ -1958,7 +2286,7 @@ Gaffer::ValuePlug::CachePolicy OpenImageIOReader::computeCachePolicy( const Gaff
 		// For our most common case, reading Exrs using ExrCore, we are able to have multiple threads join
 		// and help with reading ( the actual file reads probably don't benefit too much from multithreading,
 		// but decompression benefits a lot )
-		return ValuePlug::CachePolicy::TaskCollaboration;
+		return g_tileBatchCachePolicy;
 	}
 	else if( output == outPlug()->channelDataPlug() )
 	{
@@ -388,15 +388,15 @@ public:
 		// djbsort would perform.
 		std::sort( currentRow, currentRow + m_size.x );
 
-		// Update m_splits for this row to preserve the invariant - it needs to be set so that
-		// currentRow[i] < m_splitValue if and only if i < m_splits[i]
-		//
-		// This means that the comparison invariant is preserved, but the number of elements in the
-		// lower set may now be wrong - this will be rebalanced when currentResult() is called.
-		//
-		// I kind of wonder whether a linear search might be faster for small sizes - it's super easy for
-		// the branch predictor. But lower_bound makes sense for large sizes.
-		m_splits[rowIndex] = std::lower_bound( currentRow, &currentRow[m_size.x], m_splitValue ) - currentRow;
+		updateSplit( rowIndex );
+	}
+
+	// Alternative to sampleRow(), for use when the caller already has the row sorted
+	// ( with NaNs replaced by -inf ), as in processMedianTile().
+	inline void setSortedRow( int rowIndex, const float *sortedRow )
+	{
+		std::copy( sortedRow, sortedRow + m_size.x, &m_sortedRows[ m_size.x * rowIndex ] );
+		updateSplit( rowIndex );
 	}
 
 	inline float currentResult()
@@ -523,6 +523,21 @@ public:
 
 private:
 
+	inline void updateSplit( int rowIndex )
+	{
+		const float *currentRow = &m_sortedRows[ m_size.x * rowIndex ];
+
+		// Update m_splits for this row to preserve the invariant - it needs to be set so that
+		// currentRow[i] < m_splitValue if and only if i < m_splits[i]
+		//
+		// This means that the comparison invariant is preserved, but the number of elements in the
+		// lower set may now be wrong - this will be rebalanced when currentResult() is called.
+		//
+		// I kind of wonder whether a linear search might be faster for small sizes - it's super easy for
+		// the branch predictor. But lower_bound makes sense for large sizes.
+		m_splits[rowIndex] = std::lower_bound( currentRow, &currentRow[m_size.x], m_splitValue ) - currentRow;
+	}
+
 	// Size of the filter, x is the size of each row, y is the number of rows
 	V2i m_size;
 
@@ -575,46 +590,181 @@ inline int positiveModulo( int a, int d )
 	return ( ( a % d ) + d ) % d;
 }
 
-// Fill in an accumulator buffer of the appropriate type, and then step it through each pixel, outputting
-// the result for each pixel in the tile.
-template< class Buffer >
-void processTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+// Fill in a RankMedianBuffer, and then step it through each pixel, outputting the result for each pixel
+// in the tile. The bulk of the cost is in sorting each row within the support of each pixel, but
+// neighbouring pixels in a scanline share all
+// but one pixel of each row. So we keep a sorted window for every row of the input, and when stepping from
+// one column to the next we just remove the pixel leaving the window and insert the pixel entering it.
+// This is O( N ) in the filter width, but is little more than a memmove, compared to O( N log N ) for a
+// sort. The sorted rows are identical to those that sampleRow() would produce, so results are unchanged.
+void processMedianTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
 {
-	V2i s = 2 * radius + V2i( 1 );
-	Buffer buffer( s );
+	const V2i s = 2 * radius + V2i( 1 );
+	const int minY = tileBound.min.y - radius.y;
+	const int maxY = tileBound.max.y + radius.y;
+	const int numRows = maxY - minY;
+
+	// Sorted window for each input row, with row `y` stored in elements
+	// [ ( y - minY ) * s.x ... ( y - minY + 1 ) * s.x - 1 ]
+	vector<float> windows( numRows * s.x );
+	// Pixels leaving and entering the window of each row as we step to the next column.
+	vector<float> outgoing( numRows );
+	vector<float> incoming( numRows );
+
+	auto visitColumn = [&sampler, minY, maxY] ( int columnX, vector<float> &column ) {
+		float *writePos = column.data();
+		sampler.visitPixels( Box2i( V2i( columnX, minY ), V2i( columnX + 1, maxY ) ),
+			[&writePos] ( float v, int x, int y )
+			{
+				*writePos++ = std::isnan( v ) ? -infinity : v;
+			}
+		);
+	};
+
+	RankMedianBuffer buffer( s );
 	V2i p;
 	for( p.x = tileBound.min.x; p.x < tileBound.max.x; ++p.x )
 	{
-		p.y = tileBound.min.y;
+		IECore::Canceller::check( canceller );
 
-		// For the set of pixels to include in each row of the buffer, we need a bound.
-		// Initialize this to the first row within the support of the first pixel in this column
-		Imath::Box2i rowBound( p + V2i( -radius ), p + V2i( radius.x + 1, -radius.y + 1 ) );
+		if( p.x == tileBound.min.x )
+		{
+			// Fill and sort the windows for the first column from scratch.
+			float *writePos = windows.data();
+			sampler.visitPixels( Box2i( V2i( p.x - radius.x, minY ), V2i( p.x + radius.x + 1, maxY ) ),
+				[&writePos] ( float v, int x, int y )
+				{
+					*writePos++ = std::isnan( v ) ? -infinity : v;
+				}
+			);
+			for( int i = 0; i < numRows; ++i )
+			{
+				std::sort( &windows[i * s.x], &windows[i * s.x] + s.x );
+			}
+		}
+		else
+		{
+			// Slide the windows along by one pixel.
+			visitColumn( p.x - radius.x - 1, outgoing );
+			visitColumn( p.x + radius.x, incoming );
+			for( int i = 0; i < numRows; ++i )
+			{
+				float *row = &windows[i * s.x];
+				const float in = incoming[i];
+				int j = std::lower_bound( row, row + s.x, outgoing[i] ) - row;
+				// Shuffle elements over the removed one until we reach the
+				// insertion point for the new one.
+				if( in > row[j] )
+				{
+					for( ; j + 1 < s.x && row[j+1] < in; ++j )
+					{
+						row[j] = row[j+1];
+					}
+				}
+				else
+				{
+					for( ; j > 0 && row[j-1] > in; --j )
+					{
+						row[j] = row[j-1];
+					}
+				}
+				row[j] = in;
+			}
+		}
 
-		// Step through all but one row of the support of the first pixel, calling sampleRow on the buffer
-		// so that every slot of the buffer is occupied with data for this pixel ( except for one row
-		// that will be filled on the first iteration of the for loop below.
-		while( rowBound.min.y < tileBound.min.y + radius.y )
+		for( int y = minY; y < tileBound.min.y + radius.y; ++y )
 		{
-			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
-			rowBound.min.y++;
-			rowBound.max.y++;
+			buffer.setSortedRow( positiveModulo( y, s.y ), &windows[( y - minY ) * s.x] );
 		}
 
 		for( p.y = tileBound.min.y; p.y < tileBound.max.y; ++p.y )
 		{
-			IECore::Canceller::check( canceller );
+			const int y = p.y + radius.y;
+			buffer.setSortedRow( positiveModulo( y, s.y ), &windows[( y - minY ) * s.x] );
+			result[ ImagePlug::pixelIndex( p, tileBound.min ) ] = buffer.currentResult();
+		}
+	}
+}
 
-			// Replace one row of the buffer with the next row
-			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
+struct MinOp
+{
+	static float identity() { return infinity; }
+	float operator()( float a, float b ) const { return std::min( a, b ); }
+};
 
-			// We now have a buffer with all the row data for this pixel, we can get the result for this pixel
-			result[ ImagePlug::pixelIndex( p, tileBound.min ) ] = buffer.currentResult();
+struct MaxOp
+{
+	static float identity() { return -infinity; }
+	float operator()( float a, float b ) const { return std::max( a, b ); }
+};
 
-			// Step to the next row
-			rowBound.min.y++;
-			rowBound.max.y++;
+// Computes `out[i * outStride] = op( in[i * inStride] ... in[( i + window - 1 ) * inStride] )` for
+// `i` in `[ 0, count )`, using the van Herk/Gil-Werman algorithm. The input is divided into blocks of
+// `window` elements, and we compute running results forwards and backwards within each block. Any window
+// spans at most two blocks, so its result is just `op( backward[i], forward[i + window - 1] )`, giving
+// a cost of 3 comparisons per element regardless of the window size.
+template<typename Op>
+void slidingExtremum( const float *in, int inStride, float *out, int outStride, int count, int window, vector<float> &forward, vector<float> &backward )
+{
+	const Op op;
+	const int n = count + window - 1;
+	forward.resize( n );
+	backward.resize( n );
+
+	for( int i = 0; i < n; ++i )
+	{
+		const float v = in[i * inStride];
+		forward[i] = i % window ? op( forward[i-1], v ) : v;
+	}
+
+	for( int i = n - 1; i >= 0; --i )
+	{
+		const float v = in[i * inStride];
+		backward[i] = ( i == n - 1 || ( i + 1 ) % window == 0 ) ? v : op( backward[i+1], v );
+	}
+
+	for( int i = 0; i < count; ++i )
+	{
+		out[i * outStride] = op( backward[i], forward[i + window - 1] );
+	}
+}
+
+// Computes the minimum or maximum for each pixel in the tile. Min and max are separable, so
+// rather than using RankMinBuffer or RankMaxBuffer to scan the support of each pixel we make a
+// horizontal pass followed by a vertical pass, each using slidingExtremum() so that the cost per pixel
+// is independent of the radius.
+template<typename Op>
+void processMinMaxTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const V2i s = 2 * radius + V2i( 1 );
+	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
+	const V2i inputSize = inputBound.size();
+	const int tileSize = ImagePlug::tileSize();
+
+	// NaNs are ignored by RankMinBuffer and RankMaxBuffer, which is equivalent to
+	// replacing them with the identity for the operation.
+	vector<float> input( inputSize.x * inputSize.y );
+	float *writePos = input.data();
+	sampler.visitPixels( inputBound,
+		[&writePos] ( float v, int x, int y )
+		{
+			*writePos++ = std::isnan( v ) ? Op::identity() : v;
 		}
+	);
+
+	vector<float> horizontal( tileSize * inputSize.y );
+	vector<float> forward;
+	vector<float> backward;
+	for( int y = 0; y < inputSize.y; ++y )
+	{
+		IECore::Canceller::check( canceller );
+		slidingExtremum<Op>( &input[y * inputSize.x], 1, &horizontal[y * tileSize], 1, tileSize, s.x, forward, backward );
+	}
+
+	for( int x = 0; x < tileSize; ++x )
+	{
+		IECore::Canceller::check( canceller );
+		slidingExtremum<Op>( &horizontal[x], tileSize, &result[x], tileSize, tileSize, s.y, forward, backward );
 	}
 }
 
@@ -642,7 +792,7 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 		{
 			IECore::Canceller::check( canceller );
 
-			// Find the result for this pixel, same as in processTile() above
+			// Replace one row of the buffer with the next row, and find the result for this pixel
 			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
 			float resultValue = buffer.currentResult();
 
@@ -880,13 +1030,13 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 	switch( m_mode )
 	{
 		case MedianRank:
-			processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processMedianTile( sampler, radius, tileBound, result, context->canceller() );
 			break;
 		case ErodeRank:
-			processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processMinMaxTile<MinOp>( sampler, radius, tileBound, result, context->canceller() );
 			break;
 		case DilateRank:
-			processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processMinMaxTile<MaxOp>( sampler, radius, tileBound, result, context->canceller() );
 			break;
 	}
 
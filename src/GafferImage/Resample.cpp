@@ -44,6 +44,7 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECore/NullObject.h"
 
@@ -52,6 +53,7 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
 
 using namespace Imath;
 using namespace IECore;
@@ -236,12 +238,6 @@ inline std::pair< int, int > filterSupport( const float filterRadius, const int
 
 // Precomputes all the filter weights for a whole row or column of a tile. For separable
 // filters these weights can then be reused across all rows/columns in the same tile.
-/// \todo The weights computed for a particular tile could also be reused for all
-/// tiles in the same tile column or row. We could achieve this by outputting
-/// the weights on an internal plug, and using Gaffer's caching to ensure they are
-/// only computed once and then reused. At the time of writing, profiles indicate that
-/// accessing pixels via the Sampler is the main bottleneck, but once that is optimised
-/// perhaps cached filter weights could have a benefit.
 void filterWeights1D( const OIIO::Filter2D *filter, const float inputFilterScale, const float filterRadius, const int x, const float ratio, const float offset, Passes pass, std::vector<int> &supportRanges, std::vector<float> &weights )
 {
 	weights.reserve( ( 2 * ceilf( filterRadius ) + 1 ) * ImagePlug::tileSize() );
@@ -271,6 +267,104 @@ void filterWeights1D( const OIIO::Filter2D *filter, const float inputFilterScale
 	}
 }
 
+// The weights computed by `filterWeights1D()` for a particular tile are also valid
+// for all other tiles in the same tile column or row, and for all channels. So we
+// store them in a cache shared by all Resample nodes, along with the total weight
+// for each output pixel.
+struct FilterWeights1D
+{
+	// Pairs of `[ min, max )` input pixel coordinates for each output pixel.
+	std::vector<int> supportRanges;
+	// The weights for each input pixel within each support range.
+	std::vector<float> weights;
+	// The sum of the weights for each output pixel.
+	std::vector<float> totals;
+};
+
+using ConstFilterWeights1DPtr = std::shared_ptr<const FilterWeights1D>;
+
+struct FilterWeightsCacheGetterKey
+{
+
+	FilterWeightsCacheGetterKey( const OIIO::Filter2D *filter, float inputFilterScale, float filterRadius, int x, float ratio, float offset, Passes pass )
+		:	filter( filter ), inputFilterScale( inputFilterScale ), filterRadius( filterRadius ), x( x ), ratio( ratio ), offset( offset ), pass( pass )
+	{
+		// Filters are owned by FilterAlgo and live for the duration of the
+		// process, so the address identifies the filter uniquely.
+		hash.append( (uint64_t)filter );
+		hash.append( inputFilterScale );
+		hash.append( filterRadius );
+		hash.append( x );
+		hash.append( ratio );
+		hash.append( offset );
+		hash.append( (int)pass );
+	}
+
+	operator const IECore::MurmurHash &() const
+	{
+		return hash;
+	}
+
+	IECore::MurmurHash hash;
+	const OIIO::Filter2D *filter;
+	const float inputFilterScale;
+	const float filterRadius;
+	const int x;
+	const float ratio;
+	const float offset;
+	const Passes pass;
+
+};
+
+using FilterWeightsCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstFilterWeights1DPtr, IECorePreview::LRUCachePolicy::Parallel, FilterWeightsCacheGetterKey>;
+
+FilterWeightsCache &filterWeightsCache()
+{
+	static FilterWeightsCache *g_cache = new FilterWeightsCache(
+		[] ( const FilterWeightsCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller ) -> ConstFilterWeights1DPtr {
+			auto result = std::make_shared<FilterWeights1D>();
+			filterWeights1D( key.filter, key.inputFilterScale, key.filterRadius, key.x, key.ratio, key.offset, key.pass, result->supportRanges, result->weights );
+
+			result->totals.reserve( ImagePlug::tileSize() );
+			auto wIt = result->weights.cbegin();
+			for( auto supportIt = result->supportRanges.cbegin(); supportIt != result->supportRanges.cend(); supportIt += 2 )
+			{
+				float total = 0.0f;
+				for( int i = *supportIt; i < *( supportIt + 1 ); ++i )
+				{
+					total += *wIt++;
+				}
+				result->totals.push_back( total );
+			}
+
+			cost = result->supportRanges.size() * sizeof( int ) + ( result->weights.size() + result->totals.size() ) * sizeof( float );
+			return result;
+		},
+		/* maxCost = */ 64 * 1024 * 1024
+	);
+	return *g_cache;
+}
+
+ConstFilterWeights1DPtr cachedFilterWeights1D( const OIIO::Filter2D *filter, const float inputFilterScale, const float filterRadius, const int x, const float ratio, const float offset, Passes pass )
+{
+	return filterWeightsCache().get( FilterWeightsCacheGetterKey( filter, inputFilterScale, filterRadius, x, ratio, offset, pass ) );
+}
+
+// Returns the union of the support ranges in `weights`.
+std::pair<int, int> supportBound( const FilterWeights1D &weights )
+{
+	std::pair<int, int> result( std::numeric_limits<int>::max(), std::numeric_limits<int>::min() );
+	for( auto it = weights.supportRanges.cbegin(); it != weights.supportRanges.cend(); it += 2 )
+	{
+		if( *it < *( it + 1 ) )
+		{
+			result.first = std::min( result.first, *it );
+			result.second = std::max( result.second, *( it + 1 ) );
+		}
+	}
+	return result;
+}
+
 // For the inseparable case, we can't always reuse the weights for an adjacent row or column.
 // There are a lot of possible scaling factors where the ratio can be represented as a fraction,
 // and the weights needed would repeat after a certain number of pixels, and we could compute weights
@@ -2166,10 +2260,13 @@ IECore::ConstFloatVectorDataPtr Resample::computeChannelData( const std::string
 		// debug mode causes this pass to be output directly for inspection.
 
 		// Pixels in the same column share the same support ranges and filter weights, so
-		// we precompute the weights now to avoid repeating work later.
-		std::vector<int> supportRanges;
-		std::vector<float> weights;
-		filterWeights1D( filter, inputFilterScale.x, filterRadius.x, tileBound.min.x, ratio.x, offset.x, Horizontal, supportRanges, weights );
+		// we use precomputed weights to avoid repeating work.
+		ConstFilterWeights1DPtr filterWeights = cachedFilterWeights1D( filter, inputFilterScale.x, filterRadius.x, tileBound.min.x, ratio.x, offset.x, Horizontal );
+		const std::pair<int, int> support = supportBound( *filterWeights );
+
+		// We read each row of input once, so that each output pixel is then
+		// just the dot product of the weights with a contiguous span of the row.
+		std::vector<float> row( std::max( 0, support.second - support.first ) );
 
 		V2i oP; // output pixel position
 
@@ -2177,83 +2274,105 @@ IECore::ConstFloatVectorDataPtr Resample::computeChannelData( const std::string
 		{
 			Canceller::check( context->canceller() );
 
-			std::vector<int>::const_iterator supportIt = supportRanges.begin();
-			std::vector<float>::const_iterator wIt = weights.begin();
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			if( row.size() )
 			{
-				float v = 0.0f;
-				float totalW = 0.0f;
-
+				float *rowIt = row.data();
 				sampler.visitPixels( Imath::Box2i(
-						Imath::V2i( *supportIt, oP.y ),
-						Imath::V2i( *( supportIt + 1 ), oP.y + 1 )
+						Imath::V2i( support.first, oP.y ),
+						Imath::V2i( support.second, oP.y + 1 )
 					),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
+					[&rowIt]( float cur, int x, int y )
 					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
+						*rowIt++ = cur;
 					}
 				);
+			}
+
+			std::vector<int>::const_iterator supportIt = filterWeights->supportRanges.begin();
+			const float *w = filterWeights->weights.data();
+			std::vector<float>::const_iterator totalIt = filterWeights->totals.begin();
+			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			{
+				const int n = *( supportIt + 1 ) - *supportIt;
+				const float *in = row.data() + ( *supportIt - support.first );
 
+				float v = 0.0f;
+				for( int i = 0; i < n; ++i )
+				{
+					v += w[i] * in[i];
+				}
+
+				w += n;
 				supportIt += 2;
 
-				if( totalW != 0.0f )
+				if( *totalIt != 0.0f )
 				{
-					*pIt = v / totalW;
+					*pIt = v / *totalIt;
 				}
 
+				++totalIt;
 				++pIt;
 			}
 		}
 	}
 	else if( passes == Vertical )
 	{
-		V2i oP; // output pixel position
-
 		// Pixels in the same row share the same support ranges and filter weights, so
-		// we precompute the weights now to avoid repeating work later.
-		std::vector<int> supportRanges;
-		std::vector<float> weights;
-		filterWeights1D( filter, inputFilterScale.y, filterRadius.y, tileBound.min.y, ratio.y, offset.y, Vertical, supportRanges, weights );
+		// we use precomputed weights to avoid repeating work.
+		ConstFilterWeights1DPtr filterWeights = cachedFilterWeights1D( filter, inputFilterScale.y, filterRadius.y, tileBound.min.y, ratio.y, offset.y, Vertical );
+		const std::pair<int, int> support = supportBound( *filterWeights );
+		const int tileSize = ImagePlug::tileSize();
+
+		// We read all the input for the tile up front. Each output row is then
+		// a weighted sum of whole input rows, which the compiler can vectorise.
+		std::vector<float> input( std::max( 0, support.second - support.first ) * tileSize );
+		if( input.size() )
+		{
+			float *inputIt = input.data();
+			sampler.visitPixels( Imath::Box2i(
+					Imath::V2i( tileBound.min.x, support.first ),
+					Imath::V2i( tileBound.max.x, support.second )
+				),
+				[&inputIt]( float cur, int x, int y )
+				{
+					*inputIt++ = cur;
+				}
+			);
+		}
 
-		std::vector<int>::const_iterator supportIt = supportRanges.begin();
-		std::vector<float>::const_iterator rowWeightsIt = weights.begin();
+		std::vector<float> row( tileSize );
+		std::vector<int>::const_iterator supportIt = filterWeights->supportRanges.begin();
+		std::vector<float>::const_iterator wIt = filterWeights->weights.begin();
+		std::vector<float>::const_iterator totalIt = filterWeights->totals.begin();
 
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		for( int y = 0; y < tileSize; ++y )
 		{
 			Canceller::check( context->canceller() );
 
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			std::fill( row.begin(), row.end(), 0.0f );
+			for( int iY = *supportIt; iY < *( supportIt + 1 ); ++iY )
 			{
-				float v = 0.0f;
-				float totalW = 0.0f;
-
-				std::vector<float>::const_iterator wIt = rowWeightsIt;
-
-				sampler.visitPixels( Imath::Box2i(
-						Imath::V2i( oP.x, *supportIt ),
-						Imath::V2i( oP.x + 1, *(supportIt + 1) )
-					),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
-					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
-					}
-				);
-
-
-				if( totalW != 0.0f )
+				const float w = *wIt++;
+				const float *in = &input[( iY - support.first ) * tileSize];
+				float *v = row.data();
+				for( int x = 0; x < tileSize; ++x )
 				{
-					*pIt = v / totalW;
+					v[x] += w * in[x];
 				}
+			}
 
-				++pIt;
+			const float total = *totalIt;
+			if( total != 0.0f )
+			{
+				for( int x = 0; x < tileSize; ++x )
+				{
+					pIt[x] = row[x] / total;
+				}
 			}
 
-			rowWeightsIt += (*(supportIt + 1)) - (*supportIt);
+			pIt += tileSize;
 			supportIt += 2;
+			++totalIt;
 		}
 	}
 
@@ -36,15 +36,102 @@
 
 #include "GafferImage/Resize.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/Resample.h"
 #include "GafferImage/Sampler.h"
 
+#include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
 
+using namespace std;
 using namespace Imath;
 using namespace Gaffer;
 using namespace GafferImage;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Used to request a specific level from `pyramidPlug()`. When this isn't
+// present in the context, the level is provided by `pyramidLevelPlug()`.
+// We never set it to 0, because level 0 is just the input image.
+const IECore::InternedString g_pyramidLevelContextName( "__pyramidLevel" );
+
+const int g_maxPyramidLevel = 16;
+
+V2f resizeScale( const Format &inFormat, const Format &outFormat, Resize::FitMode fitMode )
+{
+	const V2f inSize( inFormat.width(), inFormat.height() );
+	const V2f outSize( outFormat.width(), outFormat.height() );
+	const V2f formatScale = outSize / inSize;
+
+	const float pixelAspectScale = outFormat.getPixelAspect() / inFormat.getPixelAspect();
+
+	if( fitMode == Resize::Fit )
+	{
+		fitMode = formatScale.x * pixelAspectScale < formatScale.y ? Resize::Horizontal : Resize::Vertical;
+	}
+	else if( fitMode == Resize::Fill )
+	{
+		fitMode = formatScale.x * pixelAspectScale < formatScale.y ? Resize::Vertical : Resize::Horizontal;
+	}
+
+	switch( fitMode )
+	{
+		case Resize::Horizontal :
+			return V2f( formatScale.x, formatScale.x * pixelAspectScale );
+		case Resize::Vertical :
+			return V2f( formatScale.y / pixelAspectScale, formatScale.y );
+		case Resize::Distort :
+		default :
+			return formatScale;
+	}
+}
+
+// Returns the deepest level which still leaves the Resample node to
+// downscale by a factor of at least 0.5. We choose the level based on
+// the axis with the least scaling, so that we never box filter more
+// than necessary in either axis.
+int pyramidLevelForScale( const V2f &scale )
+{
+	const float s = std::max( scale.x, scale.y );
+	if( !( s > 0.0f ) )
+	{
+		return 0;
+	}
+
+	int level = 0;
+	while( level < g_maxPyramidLevel && s * (float)( 1 << ( level + 1 ) ) < 1.0f )
+	{
+		level++;
+	}
+	return level;
+}
+
+Box2i pyramidDataWindow( const Box2i &dataWindow, int level )
+{
+	if( BufferAlgo::empty( dataWindow ) )
+	{
+		return dataWindow;
+	}
+
+	// Pixel `i` at `level` covers pixels `[ i * 2^level, ( i + 1 ) * 2^level )`
+	// of the input, so we round outwards to include partially covered pixels.
+	return Box2i(
+		V2i( dataWindow.min.x >> level, dataWindow.min.y >> level ),
+		V2i( -( -dataWindow.max.x >> level ), -( -dataWindow.max.y >> level ) )
+	);
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Resize
+//////////////////////////////////////////////////////////////////////////
+
 GAFFER_NODE_DEFINE_TYPE( Resize );
 
 size_t Resize::g_firstPlugIndex = 0;
@@ -58,8 +145,21 @@ Resize::Resize( const std::string &name )
 	addChild( new IntPlug( "fitMode", Plug::In, Horizontal, Horizontal, Distort ) );
 	addChild( new StringPlug( "filter" ) );
 	addChild( new BoolPlug( "filterDeep" ) );
+	addChild( new BoolPlug( "usePyramid" ) );
 	addChild( new M33fPlug( "__matrix", Plug::Out ) );
 	addChild( new ImagePlug( "__resampledIn", Plug::In, Plug::Default & ~Plug::Serialisable ) );
+	addChild( new IntPlug( "__pyramidLevel", Plug::Out ) );
+	addChild( new ImagePlug( "__pyramid", Plug::Out ) );
+
+	// The pyramid only changes the pixel data, and is never
+	// used for deep images, so everything else is passed through.
+
+	pyramidPlug()->viewNamesPlug()->setInput( inPlug()->viewNamesPlug() );
+	pyramidPlug()->formatPlug()->setInput( inPlug()->formatPlug() );
+	pyramidPlug()->metadataPlug()->setInput( inPlug()->metadataPlug() );
+	pyramidPlug()->channelNamesPlug()->setInput( inPlug()->channelNamesPlug() );
+	pyramidPlug()->deepPlug()->setInput( inPlug()->deepPlug() );
+	pyramidPlug()->sampleOffsetsPlug()->setInput( inPlug()->sampleOffsetsPlug() );
 
 	// We don't really do much work ourselves - we just
 	// defer to an internal Resample node to do the hard
@@ -68,7 +168,7 @@ Resize::Resize( const std::string &name )
 	ResamplePtr resample = new Resample( "__resample" );
 	addChild( resample );
 
-	resample->inPlug()->setInput( inPlug() );
+	resample->inPlug()->setInput( pyramidPlug() );
 
 	resample->filterPlug()->setInput( filterPlug() );
 	resample->filterDeepPlug()->setInput( filterDeepPlug() );
@@ -127,24 +227,54 @@ const Gaffer::BoolPlug *Resize::filterDeepPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 3 );
 }
 
+Gaffer::BoolPlug *Resize::usePyramidPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 4 );
+}
+
+const Gaffer::BoolPlug *Resize::usePyramidPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 4 );
+}
+
 Gaffer::M33fPlug *Resize::matrixPlug()
 {
-	return getChild<M33fPlug>( g_firstPlugIndex + 4 );
+	return getChild<M33fPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::M33fPlug *Resize::matrixPlug() const
 {
-	return getChild<M33fPlug>( g_firstPlugIndex + 4 );
+	return getChild<M33fPlug>( g_firstPlugIndex + 5 );
 }
 
 ImagePlug *Resize::resampledInPlug()
 {
-	return getChild<ImagePlug>( g_firstPlugIndex + 5 );
+	return getChild<ImagePlug>( g_firstPlugIndex + 6 );
 }
 
 const ImagePlug *Resize::resampledInPlug() const
 {
-	return getChild<ImagePlug>( g_firstPlugIndex + 5 );
+	return getChild<ImagePlug>( g_firstPlugIndex + 6 );
+}
+
+Gaffer::IntPlug *Resize::pyramidLevelPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 7 );
+}
+
+const Gaffer::IntPlug *Resize::pyramidLevelPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 7 );
+}
+
+ImagePlug *Resize::pyramidPlug()
+{
+	return getChild<ImagePlug>( g_firstPlugIndex + 8 );
+}
+
+const ImagePlug *Resize::pyramidPlug() const
+{
+	return getChild<ImagePlug>( g_firstPlugIndex + 8 );
 }
 
 void Resize::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -155,12 +285,41 @@ void Resize::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs
 		formatPlug()->isAncestorOf( input ) ||
 		input == fitModePlug() ||
 		input == inPlug()->formatPlug() ||
-		input == inPlug()->dataWindowPlug()
+		input == inPlug()->dataWindowPlug() ||
+		input == pyramidLevelPlug()
 	)
 	{
 		outputs.push_back( matrixPlug() );
 	}
 
+	if(
+		formatPlug()->isAncestorOf( input ) ||
+		input == fitModePlug() ||
+		input == usePyramidPlug() ||
+		input == inPlug()->formatPlug() ||
+		input == inPlug()->deepPlug()
+	)
+	{
+		outputs.push_back( pyramidLevelPlug() );
+	}
+
+	if(
+		input == inPlug()->dataWindowPlug() ||
+		input == pyramidLevelPlug()
+	)
+	{
+		outputs.push_back( pyramidPlug()->dataWindowPlug() );
+	}
+
+	if(
+		input == inPlug()->channelDataPlug() ||
+		input == inPlug()->dataWindowPlug() ||
+		input == pyramidLevelPlug()
+	)
+	{
+		outputs.push_back( pyramidPlug()->channelDataPlug() );
+	}
+
 	if( formatPlug()->isAncestorOf( input ) )
 	{
 		outputs.push_back( outPlug()->formatPlug() );
@@ -199,6 +358,15 @@ void Resize::hash( const ValuePlug *output, const Context *context, IECore::Murm
 		fitModePlug()->hash( h );
 		inPlug()->formatPlug()->hash( h );
 		inPlug()->dataWindowPlug()->hash( h );
+		pyramidLevelPlug()->hash( h );
+	}
+	else if( output == pyramidLevelPlug() )
+	{
+		usePyramidPlug()->hash( h );
+		inPlug()->deepPlug()->hash( h );
+		formatPlug()->hash( h );
+		fitModePlug()->hash( h );
+		inPlug()->formatPlug()->hash( h );
 	}
 }
 
@@ -211,34 +379,7 @@ void Resize::compute( ValuePlug *output, const Context *context ) const
 
 		const V2f inSize( inFormat.width(), inFormat.height() );
 		const V2f outSize( outFormat.width(), outFormat.height() );
-		const V2f formatScale = outSize / inSize;
-
-		const float pixelAspectScale = outFormat.getPixelAspect() / inFormat.getPixelAspect();
-
-		FitMode fitMode = (FitMode)fitModePlug()->getValue();
-		if( fitMode == Fit )
-		{
-			fitMode = formatScale.x * pixelAspectScale < formatScale.y ? Horizontal : Vertical;
-		}
-		else if( fitMode == Fill )
-		{
-			fitMode = formatScale.x * pixelAspectScale < formatScale.y ? Vertical : Horizontal;
-		}
-
-		V2f scale;
-		switch( fitMode )
-		{
-			case Horizontal :
-				scale = V2f( formatScale.x, formatScale.x * pixelAspectScale );
-				break;
-			case Vertical :
-				scale = V2f( formatScale.y / pixelAspectScale, formatScale.y );
-				break;
-			case Distort :
-			default :
-				scale = formatScale;
-				break;
-		}
+		const V2f scale = resizeScale( inFormat, outFormat, (FitMode)fitModePlug()->getValue() );
 
 		const V2f translate = ( outSize - ( inSize * scale ) ) / 2.0f;
 
@@ -246,8 +387,29 @@ void Resize::compute( ValuePlug *output, const Context *context ) const
 		matrix.translate( translate );
 		matrix.scale( scale );
 
+		// The Resample node reads from `pyramidPlug()`, so must
+		// map from the pixel space of the pyramid level.
+		if( const int level = pyramidLevelPlug()->getValue() )
+		{
+			matrix.scale( V2f( (float)( 1 << level ) ) );
+		}
+
 		static_cast<M33fPlug *>( output )->setValue( matrix );
 	}
+	else if( output == pyramidLevelPlug() )
+	{
+		int level = 0;
+		if( usePyramidPlug()->getValue() && !inPlug()->deepPlug()->getValue() )
+		{
+			level = pyramidLevelForScale(
+				resizeScale(
+					inPlug()->formatPlug()->getValue(), formatPlug()->getValue(),
+					(FitMode)fitModePlug()->getValue()
+				)
+			);
+		}
+		static_cast<IntPlug *>( output )->setValue( level );
+	}
 
 	ImageProcessor::compute( output, context );
 }
@@ -264,21 +426,129 @@ GafferImage::Format Resize::computeFormat( const Gaffer::Context *context, const
 
 void Resize::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
+	if( parent == pyramidPlug() )
+	{
+		const int level = pyramidLevel( context );
+		if( !level )
+		{
+			h = inPlug()->dataWindowPlug()->hash();
+			return;
+		}
+
+		ImageProcessor::hashDataWindow( parent, context, h );
+		Context::EditableScope inputScope( context );
+		inputScope.remove( g_pyramidLevelContextName );
+		inPlug()->dataWindowPlug()->hash( h );
+		h.append( level );
+		return;
+	}
+
 	h = source()->dataWindowPlug()->hash();
 }
 
 Imath::Box2i Resize::computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const
 {
+	if( parent == pyramidPlug() )
+	{
+		const int level = pyramidLevel( context );
+		if( !level )
+		{
+			return inPlug()->dataWindowPlug()->getValue();
+		}
+
+		Context::EditableScope inputScope( context );
+		inputScope.remove( g_pyramidLevelContextName );
+		return pyramidDataWindow( inPlug()->dataWindowPlug()->getValue(), level );
+	}
+
 	return source()->dataWindowPlug()->getValue();
 }
 
 void Resize::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
+	if( parent == pyramidPlug() )
+	{
+		const int level = pyramidLevel( context );
+		if( !level )
+		{
+			h = inPlug()->channelDataPlug()->hash();
+			return;
+		}
+
+		ImageProcessor::hashChannelData( parent, context, h );
+
+		const std::string &channelName = context->get<string>( ImagePlug::channelNameContextName );
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+
+		// Level `n` is computed from level `n - 1`, which we read back
+		// from `pyramidPlug()` itself so that it is cached and shared
+		// between all the tiles that need it.
+		const int sourceLevel = level - 1;
+		Context::EditableScope sourceScope( context );
+		if( sourceLevel )
+		{
+			sourceScope.set( g_pyramidLevelContextName, &sourceLevel );
+		}
+		else
+		{
+			sourceScope.remove( g_pyramidLevelContextName );
+		}
+
+		const Box2i sourceWindow( tileOrigin * 2, ( tileOrigin + V2i( ImagePlug::tileSize() ) ) * 2 );
+		Sampler sampler( sourceLevel ? pyramidPlug() : inPlug(), channelName, sourceWindow, Sampler::Clamp );
+		sampler.hash( h );
+		return;
+	}
+
 	h = source()->channelDataPlug()->hash();
 }
 
 IECore::ConstFloatVectorDataPtr Resize::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
+	if( parent == pyramidPlug() )
+	{
+		const int level = pyramidLevel( context );
+		if( !level )
+		{
+			return inPlug()->channelDataPlug()->getValue();
+		}
+
+		const int sourceLevel = level - 1;
+		Context::EditableScope sourceScope( context );
+		if( sourceLevel )
+		{
+			sourceScope.set( g_pyramidLevelContextName, &sourceLevel );
+		}
+		else
+		{
+			sourceScope.remove( g_pyramidLevelContextName );
+		}
+
+		const Box2i sourceWindow( tileOrigin * 2, ( tileOrigin + V2i( ImagePlug::tileSize() ) ) * 2 );
+		Sampler sampler( sourceLevel ? pyramidPlug() : inPlug(), channelName, sourceWindow, Sampler::Clamp );
+
+		// Box filter each 2x2 block of source pixels into a single pixel.
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		vector<float> &result = resultData->writable();
+		result.resize( ImagePlug::tileSize() * ImagePlug::tileSize(), 0.0f );
+
+		sampler.visitPixels(
+			sourceWindow,
+			[&result, &sourceWindow] ( float value, int x, int y )
+			{
+				result[( ( y - sourceWindow.min.y ) >> 1 ) * ImagePlug::tileSize() + ( ( x - sourceWindow.min.x ) >> 1 )] += value;
+			}
+		);
+
+		for( auto &v : result )
+		{
+			v *= 0.25f;
+		}
+
+		return resultData;
+	}
+
 	return source()->channelDataPlug()->getValue();
 }
 
@@ -292,6 +562,17 @@ IECore::ConstIntVectorDataPtr Resize::computeSampleOffsets( const Imath::V2i &ti
 	return source()->sampleOffsetsPlug()->getValue();
 }
 
+int Resize::pyramidLevel( const Gaffer::Context *context ) const
+{
+	if( const int *level = context->getIfExists<int>( g_pyramidLevelContextName ) )
+	{
+		return *level;
+	}
+
+	ImagePlug::GlobalScope c( context );
+	return pyramidLevelPlug()->getValue();
+}
+
 const ImagePlug *Resize::source() const
 {
 	ImagePlug::GlobalScope c( Context::current() );
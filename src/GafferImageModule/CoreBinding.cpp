@@ -221,6 +221,18 @@ IECore::FloatVectorDataPtr whiteTile( bool copy )
 	return copy ? d->copy() : boost::const_pointer_cast<IECore::FloatVectorData>( d );
 }
 
+IECore::FloatVectorDataPtr constantTile( float value, bool copy )
+{
+	IECore::ConstFloatVectorDataPtr d = ImagePlug::constantTile( value );
+	return copy ? d->copy() : boost::const_pointer_cast<IECore::FloatVectorData>( d );
+}
+
+bool isConstantTile( const IECore::FloatVectorData *tile )
+{
+	float value;
+	return ImagePlug::isConstantTile( tile, value );
+}
+
 boost::python::list registeredFormats()
 {
 	std::vector<std::string> names;
@@ -351,6 +363,8 @@ void GafferImageModule::bindCore()
 		.def( "emptyTile", &emptyTile, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTile" )
 		.def( "blackTile", &blackTile, ( arg( "_copy" ) = true ) ).staticmethod( "blackTile" )
 		.def( "whiteTile", &whiteTile, ( arg( "_copy" ) = true ) ).staticmethod( "whiteTile" )
+		.def( "constantTile", &constantTile, ( arg( "value" ), arg( "_copy" ) = true ) ).staticmethod( "constantTile" )
+		.def( "isConstantTile", &isConstantTile ).staticmethod( "isConstantTile" )
 	;
 
 	using ImageNodeWrapper = ComputeNodeWrapper<ImageNode>;
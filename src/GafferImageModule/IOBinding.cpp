@@ -134,6 +134,14 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "setPrefetchMemoryLimit", &OpenImageIOReader::setPrefetchMemoryLimit )
+			.staticmethod( "setPrefetchMemoryLimit" )
+			.def( "getPrefetchMemoryLimit", &OpenImageIOReader::getPrefetchMemoryLimit )
+			.staticmethod( "getPrefetchMemoryLimit" )
+			.def( "prefetchedTileBatches", &OpenImageIOReader::prefetchedTileBatches )
+			.staticmethod( "prefetchedTileBatches" )
+			.def( "usedPrefetchedTileBatches", &OpenImageIOReader::usedPrefetchedTileBatches )
+			.staticmethod( "usedPrefetchedTileBatches" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
@@ -1584,7 +1584,9 @@ void ImageGadget::updateTiles()
 				);
 			}
 
-		}
+		},
+		// Priority
+		BackgroundTask::Priority::High
 	);
 
 }
@@ -39,6 +39,7 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/Metadata.h"
 
+#include "IECore/MessageHandler.h"
 #include "IECore/SearchPath.h"
 #include "IECore/StringAlgo.h"
 
@@ -47,6 +48,9 @@
 
 #include "boost/algorithm/string.hpp"
 #include "boost/algorithm/string/predicate.hpp"
+#include "boost/noncopyable.hpp"
+
+#include "tbb/global_control.h"
 
 #include <mutex>
 #include <condition_variable>
@@ -88,22 +92,103 @@ bool useCUDA()
 	return c && strcmp( c, "0" ) != 0;
 }
 
+int intFromEnv( const char *name, int defaultValue )
+{
+	if( const char *c = getenv( name ) )
+	{
+		try
+		{
+			return std::max( 0, std::stoi( c ) );
+		}
+		catch( const std::exception & )
+		{
+			IECore::msg( IECore::Msg::Warning, "Inference", fmt::format( "Invalid value \"{}\" for {}", c, name ) );
+		}
+	}
+	return defaultValue;
+}
+
+size_t sessionPoolSize()
+{
+	static const size_t g_size = std::max( 1, intFromEnv( "GAFFERML_SESSION_POOL_SIZE", 1 ) );
+	return g_size;
+}
+
+Ort::SessionOptions sessionOptions()
+{
+	auto sessionOpt = Ort::SessionOptions();
+	for( const auto &customLibraryPath : customOpLibraryPaths() )
+	{
+		sessionOpt.RegisterCustomOpsLibrary( customLibraryPath.c_str() );
+	}
+
+	if( useCUDA() )
+	{
+		try
+		{
+			OrtCUDAProviderOptions cudaOptions;
+			sessionOpt.AppendExecutionProvider_CUDA( cudaOptions );
+		}
+		catch( const std::exception &e )
+		{
+			throw IECore::Exception( fmt::format( "Error Initializing CUDA inference : {}", e.what() ) );
+		}
+	}
+
+	// By default ONNX creates a thread per core for each session. That is
+	// fine for a single session, but when there is a pool of them we share
+	// out the threads Gaffer is allowed to use (as controlled by the `-threads`
+	// argument to `gaffer`), so that concurrent runs don't oversubscribe the
+	// machine.
+	int intraOpThreads = intFromEnv( "GAFFERML_INTRA_OP_THREADS", 0 );
+	if( !intraOpThreads && sessionPoolSize() > 1 )
+	{
+		const size_t maxThreads = tbb::global_control::active_value( tbb::global_control::max_allowed_parallelism );
+		intraOpThreads = std::max<int>( 1, maxThreads / sessionPoolSize() );
+	}
+	if( intraOpThreads )
+	{
+		sessionOpt.SetIntraOpNumThreads( intraOpThreads );
+	}
+
+	if( const int interOpThreads = intFromEnv( "GAFFERML_INTER_OP_THREADS", 0 ) )
+	{
+		sessionOpt.SetExecutionMode( ExecutionMode::ORT_PARALLEL );
+		sessionOpt.SetInterOpNumThreads( interOpThreads );
+	}
+
+	return sessionOpt;
+}
+
 // Constructing a session (loading a model) is relatively expensive,
-// so we only ever create a single session per model. I can't find
-// a reference for this in the docs, but `Session::Run()` is thread-safe
+// so by default we only ever create a single session per model. I can't
+// find a reference for this in the docs, but `Session::Run()` is thread-safe
 // and can be called concurrently by multiple clients :
 //
 // https://github.com/microsoft/onnxruntime/issues/114
-Ort::Session &acquireSession( const std::string &fileName )
+//
+// Concurrent runs on the same session do contend for its memory arena
+// and thread pool though, so `GAFFERML_SESSION_POOL_SIZE` may be used to
+// allow additional sessions to be created on demand. Clients are given
+// the least busy session in the pool.
+struct SessionPool
+{
+	std::filesystem::path path;
+	std::mutex mutex;
+	std::vector<std::unique_ptr<Ort::Session>> sessions;
+	std::vector<size_t> users;
+};
+
+SessionPool &acquireSessionPool( const std::string &fileName )
 {
 	static std::mutex g_mutex;
-	static std::unordered_map<string, Ort::Session> g_map;
+	static std::unordered_map<string, std::unique_ptr<SessionPool>> g_map;
 	lock_guard<mutex> lock( g_mutex );
 
 	auto it = g_map.find( fileName );
 	if( it != g_map.end() )
 	{
-		return it->second;
+		return *it->second;
 	}
 
 	const char *sp = getenv( "GAFFERML_MODEL_PATHS" );
@@ -116,28 +201,55 @@ Ort::Session &acquireSession( const std::string &fileName )
 		throw Exception( fmt::format( "Could not find file \"{}\" on GAFFERML_MODEL_PATHS", fileName ) );
 	}
 
-	auto sessionOpt = Ort::SessionOptions();
-	for( const auto &customLibraryPath : customOpLibraryPaths() )
-	{
-		sessionOpt.RegisterCustomOpsLibrary( customLibraryPath.c_str() );
-	}
+	// Create the first session immediately, so that errors loading the
+	// model are reported here rather than later.
+	auto pool = std::make_unique<SessionPool>();
+	pool->path = path;
+	pool->sessions.push_back( std::make_unique<Ort::Session>( acquireEnv(), path.c_str(), sessionOptions() ) );
+	pool->users.push_back( 0 );
 
-	if( useCUDA() )
-	{
-		try
+	it = g_map.try_emplace( fileName, std::move( pool ) ).first;
+	return *it->second;
+}
+
+class SessionHandle : boost::noncopyable
+{
+
+	public :
+
+		SessionHandle( const std::string &fileName )
+			:	m_pool( acquireSessionPool( fileName ) )
 		{
-			OrtCUDAProviderOptions cudaOptions;
-			sessionOpt.AppendExecutionProvider_CUDA( cudaOptions );
+			lock_guard<mutex> lock( m_pool.mutex );
+			m_index = std::min_element( m_pool.users.begin(), m_pool.users.end() ) - m_pool.users.begin();
+			if( m_pool.users[m_index] && m_pool.sessions.size() < sessionPoolSize() )
+			{
+				m_pool.sessions.push_back( std::make_unique<Ort::Session>( acquireEnv(), m_pool.path.c_str(), sessionOptions() ) );
+				m_pool.users.push_back( 0 );
+				m_index = m_pool.sessions.size() - 1;
+			}
+			m_pool.users[m_index]++;
+			m_session = m_pool.sessions[m_index].get();
 		}
-		catch( const std::exception &e )
+
+		~SessionHandle()
 		{
-			throw IECore::Exception( fmt::format( "Error Initializing CUDA inference : {}", e.what() ) );
+			lock_guard<mutex> lock( m_pool.mutex );
+			m_pool.users[m_index]--;
 		}
-	}
 
-	it = g_map.try_emplace( fileName, acquireEnv(), path.c_str(), sessionOpt ).first;
-	return it->second;
-}
+		Ort::Session &session()
+		{
+			return *m_session;
+		}
+
+	private :
+
+		SessionPool &m_pool;
+		size_t m_index;
+		Ort::Session *m_session;
+
+};
 
 struct AsyncWaiter
 {
@@ -189,6 +301,331 @@ struct AsyncWaiter
 
 };
 
+std::vector<Ort::Value> run(
+	Ort::Session &session,
+	const std::vector<const char *> &inputNames, const std::vector<OrtValue *> &inputs,
+	const std::vector<const char *> &outputNames,
+	const IECore::Canceller *canceller
+)
+{
+	vector<Ort::Value> outputs;
+	for( size_t i = 0; i < outputNames.size(); ++i )
+	{
+		outputs.push_back( Ort::Value( nullptr ) );
+	}
+
+	// Run inference asynchronously on an ONNX thread. This allows us
+	// to check for cancellation via our AsyncWaiter.
+
+	Ort::RunOptions runOptions;
+	if( useCUDA() )
+	{
+		/// \todo Use `Env::GetEpDevices()` to get the names of all
+		/// available devices, instead of assuming a single `gpu:0` device.
+		/// We need to upgrade the ONNX version before we can do that
+		/// though.
+		runOptions.AddConfigEntry( kOrtRunOptionsConfigEnableMemoryArenaShrinkage, "gpu:0" );
+	}
+	AsyncWaiter waiter( runOptions );
+
+	session.RunAsync(
+		runOptions, inputNames.data(),
+		// The Ort C++ API wants us to pass `Ort::Value *`, but `Ort::Value`
+		// is non-copyable and the original `Ort::Value` instances are in
+		// separate TensorDatas and can't be moved. But `Ort::Value` has the
+		// same layout as `OrtValue *` (the underlying C type) so we can
+		// just reinterpret cast from the latter. Indeed, `Run()` is going
+		// to cast straight back to `OrtValue *` to call the C API!
+		reinterpret_cast<const Ort::Value *>( inputs.data() ),
+		inputs.size(),
+		outputNames.data(),
+		outputs.data(),
+		outputNames.size(),
+		waiter.callback,
+		&waiter
+	);
+
+	waiter.wait( canceller );
+
+	return outputs;
+}
+
+// Tiled inference
+// ===============
+//
+// Splits large images into overlapping tiles, and runs the tiles through
+// the model in batches, so that memory usage is bounded by the tile and
+// batch sizes rather than the size of the image. Inputs with a shape of the
+// form `[ 1, ..., height, width ]` are tiled, with the tiles being stacked
+// along the first dimension to form a batch. Other inputs are passed to
+// every run unchanged. Outputs must have the same layout as the tiled
+// inputs, optionally scaled by an integer factor (for upres models),
+// and are blended back together with weights that ramp down across
+// the overlap between tiles.
+
+bool tileable( const std::vector<int64_t> &shape, ONNXTensorElementDataType elementType )
+{
+	return elementType == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT && shape.size() >= 3 && shape[0] == 1;
+}
+
+// Returns the product of all dimensions other than the first and
+// last two, which for an NCHW tensor is the number of channels.
+int64_t numPlanes( const std::vector<int64_t> &shape )
+{
+	int64_t result = 1;
+	for( size_t i = 1; i < shape.size() - 2; ++i )
+	{
+		result *= shape[i];
+	}
+	return result;
+}
+
+// Returns the origins of tiles of length `tileSize` covering `size`. Adjacent
+// tiles overlap by at least `overlap`, with the last tile being shifted back
+// to end at `size`, so that all tiles have the same size.
+std::vector<int64_t> tileOrigins( int64_t size, int64_t tileSize, int64_t overlap )
+{
+	std::vector<int64_t> result;
+	const int64_t step = std::max<int64_t>( 1, tileSize - overlap );
+	for( int64_t o = 0; ; o += step )
+	{
+		if( o + tileSize >= size )
+		{
+			result.push_back( size - tileSize );
+			break;
+		}
+		result.push_back( o );
+	}
+	return result;
+}
+
+// Returns blending weights for the `tileSize * scale` output pixels of a tile
+// along one axis. Weights ramp from 0 to 1 across the overlap, except
+// at the edges of the image where there is no neighbouring tile.
+std::vector<float> tileWeights( int64_t origin, int64_t tileSize, int64_t size, int64_t overlap, int64_t scale )
+{
+	std::vector<float> result( tileSize * scale, 1.0f );
+	if( !overlap )
+	{
+		return result;
+	}
+
+	const bool rampStart = origin > 0;
+	const bool rampEnd = origin + tileSize < size;
+	for( int64_t i = 0; i < (int64_t)result.size(); ++i )
+	{
+		const float u = ( (float)i + 0.5f ) / (float)scale;
+		if( rampStart )
+		{
+			result[i] = std::min( result[i], u / (float)overlap );
+		}
+		if( rampEnd )
+		{
+			result[i] = std::min( result[i], ( (float)tileSize - u ) / (float)overlap );
+		}
+	}
+	return result;
+}
+
+std::vector<Ort::Value> runTiled(
+	Ort::Session &session,
+	const std::vector<const char *> &inputNames, const std::vector<OrtValue *> &inputs,
+	const std::vector<const char *> &outputNames,
+	int64_t tileSize, int64_t overlap, int64_t batchSize,
+	const IECore::Canceller *canceller
+)
+{
+	if( overlap >= tileSize )
+	{
+		// Otherwise we'd step forward by a single pixel for each tile,
+		// running the model for practically every pixel in the image.
+		throw IECore::Exception( fmt::format( "Tile overlap ({}) must be less than tile size ({})", overlap, tileSize ) );
+	}
+
+	// Find the inputs to be tiled, and check they have matching sizes.
+
+	int64_t width = -1;
+	int64_t height = -1;
+	std::vector<bool> tiled;
+	for( auto input : inputs )
+	{
+		auto info = reinterpret_cast<const Ort::Value *>( &input )->GetTensorTypeAndShapeInfo();
+		const std::vector<int64_t> shape = info.GetShape();
+		tiled.push_back( tileable( shape, info.GetElementType() ) );
+		if( !tiled.back() )
+		{
+			continue;
+		}
+		if( width == -1 )
+		{
+			width = shape[shape.size()-1];
+			height = shape[shape.size()-2];
+		}
+		else if( width != shape[shape.size()-1] || height != shape[shape.size()-2] )
+		{
+			throw IECore::Exception( "Tiled inputs must all have the same width and height" );
+		}
+	}
+
+	if( width == -1 )
+	{
+		throw IECore::Exception( "Tiled inference requires at least one float input with a shape of the form `[ 1, ..., height, width ]`" );
+	}
+
+	const int64_t tileWidth = std::min( tileSize, width );
+	const int64_t tileHeight = std::min( tileSize, height );
+
+	std::vector<std::pair<int64_t, int64_t>> tiles;
+	for( auto y : tileOrigins( height, tileHeight, overlap ) )
+	{
+		for( auto x : tileOrigins( width, tileWidth, overlap ) )
+		{
+			tiles.push_back( { x, y } );
+		}
+	}
+
+	// Run batches, accumulating weighted outputs.
+
+	struct Accumulator
+	{
+		std::vector<int64_t> shape;
+		int64_t scale;
+		std::vector<float> values;
+		std::vector<float> weights;
+	};
+	std::vector<Accumulator> accumulators( outputNames.size() );
+
+	Ort::AllocatorWithDefaultOptions allocator;
+	for( size_t batchBegin = 0; batchBegin < tiles.size(); batchBegin += batchSize )
+	{
+		const size_t batchEnd = std::min( tiles.size(), batchBegin + batchSize );
+		const int64_t numTiles = batchEnd - batchBegin;
+
+		std::vector<Ort::Value> batchInputOwners;
+		std::vector<OrtValue *> batchInputs;
+		for( size_t i = 0; i < inputs.size(); ++i )
+		{
+			if( !tiled[i] )
+			{
+				batchInputs.push_back( inputs[i] );
+				continue;
+			}
+
+			const Ort::Value &input = *reinterpret_cast<const Ort::Value *>( &inputs[i] );
+			std::vector<int64_t> shape = input.GetTensorTypeAndShapeInfo().GetShape();
+			const int64_t planes = numPlanes( shape );
+			shape[0] = numTiles;
+			shape[shape.size()-2] = tileHeight;
+			shape[shape.size()-1] = tileWidth;
+
+			Ort::Value batchInput = Ort::Value::CreateTensor<float>( allocator, shape.data(), shape.size() );
+			float *dst = batchInput.GetTensorMutableData<float>();
+			const float *src = input.GetTensorData<float>();
+			for( size_t t = batchBegin; t < batchEnd; ++t )
+			{
+				for( int64_t p = 0; p < planes; ++p )
+				{
+					for( int64_t y = 0; y < tileHeight; ++y )
+					{
+						const float *srcRow = src + ( p * height + tiles[t].second + y ) * width + tiles[t].first;
+						dst = std::copy( srcRow, srcRow + tileWidth, dst );
+					}
+				}
+			}
+
+			batchInputs.push_back( batchInput );
+			batchInputOwners.push_back( std::move( batchInput ) );
+		}
+
+		std::vector<Ort::Value> batchOutputs = run( session, inputNames, batchInputs, outputNames, canceller );
+
+		for( size_t o = 0; o < batchOutputs.size(); ++o )
+		{
+			auto info = batchOutputs[o].GetTensorTypeAndShapeInfo();
+			std::vector<int64_t> shape = info.GetShape();
+			if(
+				info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT ||
+				shape.size() < 3 || shape[0] != numTiles ||
+				shape[shape.size()-1] % tileWidth || shape[shape.size()-2] % tileHeight ||
+				shape[shape.size()-1] / tileWidth != shape[shape.size()-2] / tileHeight
+			)
+			{
+				throw IECore::Exception( fmt::format(
+					"Output \"{}\" is not compatible with tiled inference. Tiled outputs must be float tensors with the same width and height as the tiled inputs, or scaled by an integer factor",
+					outputNames[o]
+				) );
+			}
+
+			Accumulator &accumulator = accumulators[o];
+			const int64_t scale = shape[shape.size()-1] / tileWidth;
+			const int64_t planes = numPlanes( shape );
+			const int64_t outWidth = width * scale;
+			const int64_t outHeight = height * scale;
+			if( accumulator.shape.empty() )
+			{
+				accumulator.shape = shape;
+				accumulator.shape[0] = 1;
+				accumulator.shape[shape.size()-2] = outHeight;
+				accumulator.shape[shape.size()-1] = outWidth;
+				accumulator.scale = scale;
+				accumulator.values.resize( planes * outWidth * outHeight, 0.0f );
+				accumulator.weights.resize( outWidth * outHeight, 0.0f );
+			}
+			else if( scale != accumulator.scale || planes != numPlanes( accumulator.shape ) )
+			{
+				throw IECore::Exception( fmt::format( "Output \"{}\" changed shape between tiles", outputNames[o] ) );
+			}
+
+			const int64_t outTileWidth = tileWidth * scale;
+			const int64_t outTileHeight = tileHeight * scale;
+			const float *src = batchOutputs[o].GetTensorData<float>();
+			for( size_t t = batchBegin; t < batchEnd; ++t )
+			{
+				const std::vector<float> xWeights = tileWeights( tiles[t].first, tileWidth, width, overlap, scale );
+				const std::vector<float> yWeights = tileWeights( tiles[t].second, tileHeight, height, overlap, scale );
+				const int64_t outX = tiles[t].first * scale;
+				const int64_t outY = tiles[t].second * scale;
+				for( int64_t p = 0; p < planes; ++p )
+				{
+					for( int64_t y = 0; y < outTileHeight; ++y )
+					{
+						float *dst = accumulator.values.data() + ( p * outHeight + outY + y ) * outWidth + outX;
+						for( int64_t x = 0; x < outTileWidth; ++x )
+						{
+							dst[x] += *src++ * xWeights[x] * yWeights[y];
+						}
+					}
+				}
+				for( int64_t y = 0; y < outTileHeight; ++y )
+				{
+					float *dst = accumulator.weights.data() + ( outY + y ) * outWidth + outX;
+					for( int64_t x = 0; x < outTileWidth; ++x )
+					{
+						dst[x] += xWeights[x] * yWeights[y];
+					}
+				}
+			}
+		}
+	}
+
+	// Normalise the accumulated outputs.
+
+	std::vector<Ort::Value> result;
+	for( auto &accumulator : accumulators )
+	{
+		Ort::Value value = Ort::Value::CreateTensor<float>( allocator, accumulator.shape.data(), accumulator.shape.size() );
+		float *dst = value.GetTensorMutableData<float>();
+		const size_t planeSize = accumulator.weights.size();
+		for( size_t i = 0, e = accumulator.values.size(); i < e; ++i )
+		{
+			dst[i] = accumulator.values[i] / accumulator.weights[i % planeSize];
+		}
+		result.push_back( std::move( value ) );
+	}
+
+	return result;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -206,6 +643,10 @@ Inference::Inference( const std::string &name )
 	addChild( new StringPlug( "model" ) );
 	addChild( new ArrayPlug( "in", Plug::In, new TensorPlug( "in0" ), 0, std::numeric_limits<size_t>::max(), Plug::Default, false ) );
 	addChild( new ArrayPlug( "out", Plug::Out, new TensorPlug( "out0" ), 0, std::numeric_limits<size_t>::max(), Plug::Default, false ) );
+	addChild( new BoolPlug( "tiled" ) );
+	addChild( new IntPlug( "tileSize", Plug::In, 512, 1 ) );
+	addChild( new IntPlug( "tileOverlap", Plug::In, 32, 0 ) );
+	addChild( new IntPlug( "tileBatchSize", Plug::In, 4, 1 ) );
 	addChild( new CompoundObjectPlug( "__inference", Plug::Out ) );
 }
 
@@ -215,7 +656,8 @@ Inference::~Inference()
 
 void Inference::loadModel()
 {
-	Ort::Session &session = acquireSession( modelPlug()->getValue() );
+	SessionHandle sessionHandle( modelPlug()->getValue() );
+	Ort::Session &session = sessionHandle.session();
 
 	// Input and output names can contain characters like `.` that cannot be
 	// used in plug names. Furthermore, many models have inputs and outputs
@@ -291,14 +733,54 @@ const Gaffer::ArrayPlug *Inference::outPlug() const
 	return getChild<ArrayPlug>( g_firstPlugIndex + 2 );
 }
 
+Gaffer::BoolPlug *Inference::tiledPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::BoolPlug *Inference::tiledPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 3 );
+}
+
+Gaffer::IntPlug *Inference::tileSizePlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
+const Gaffer::IntPlug *Inference::tileSizePlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
+Gaffer::IntPlug *Inference::tileOverlapPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 5 );
+}
+
+const Gaffer::IntPlug *Inference::tileOverlapPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 5 );
+}
+
+Gaffer::IntPlug *Inference::tileBatchSizePlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 6 );
+}
+
+const Gaffer::IntPlug *Inference::tileBatchSizePlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 6 );
+}
+
 Gaffer::CompoundObjectPlug *Inference::inferencePlug()
 {
-	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 3);
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 7 );
 }
 
 const Gaffer::CompoundObjectPlug *Inference::inferencePlug() const
 {
-	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 3 );
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 7 );
 }
 
 void Inference::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -307,7 +789,11 @@ void Inference::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 
 	if(
 		input == modelPlug() ||
-		input->parent() == inPlug()
+		input->parent() == inPlug() ||
+		input == tiledPlug() ||
+		input == tileSizePlug() ||
+		input == tileOverlapPlug() ||
+		input == tileBatchSizePlug()
 	)
 	{
 		outputs.push_back( inferencePlug() );
@@ -332,6 +818,13 @@ void Inference::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *co
 		{
 			p->hash( h );
 		}
+		if( tiledPlug()->getValue() )
+		{
+			h.append( true );
+			tileSizePlug()->hash( h );
+			tileOverlapPlug()->hash( h );
+			tileBatchSizePlug()->hash( h );
+		}
 	}
 	else if( output->parent() == outPlug() )
 	{
@@ -350,8 +843,8 @@ void Inference::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	{
 		// Set up input and output tensor arrays.
 
-		const string model = modelPlug()->getValue();
-		Ort::Session &session = acquireSession( model );
+		SessionHandle sessionHandle( modelPlug()->getValue() );
+		Ort::Session &session = sessionHandle.session();
 
 		vector<Ort::AllocatedStringPtr> inputNameOwners;
 		vector<const char *> inputNames;
@@ -369,47 +862,26 @@ void Inference::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 
 		vector<Ort::AllocatedStringPtr> outputNameOwners;
 		vector<const char *> outputNames;
-		vector<Ort::Value> outputs;
 		for( auto &p : TensorPlug::OutputRange( *outPlug() ) )
 		{
 			int outputIndex = StringAlgo::numericSuffix( p->getName().string() );
 			outputNameOwners.push_back( session.GetOutputNameAllocated( outputIndex, Ort::AllocatorWithDefaultOptions() ) );
 			outputNames.push_back( outputNameOwners.back().get() );
-			outputs.push_back( Ort::Value( nullptr ) );
 		}
 
-		// Run inference asynchronously on an ONNX thread. This allows us
-		// to check for cancellation via our AsyncWaiter.
-
-		Ort::RunOptions runOptions;
-		if( useCUDA() )
+		vector<Ort::Value> outputs;
+		if( tiledPlug()->getValue() )
+		{
+			outputs = runTiled(
+				session, inputNames, inputs, outputNames,
+				tileSizePlug()->getValue(), tileOverlapPlug()->getValue(), tileBatchSizePlug()->getValue(),
+				context->canceller()
+			);
+		}
+		else
 		{
-			/// \todo Use `Env::GetEpDevices()` to get the names of all
-			/// available devices, instead of assuming a single `gpu:0` device.
-			/// We need to upgrade the ONNX version before we can do that
-			/// though.
-			runOptions.AddConfigEntry( kOrtRunOptionsConfigEnableMemoryArenaShrinkage, "gpu:0" );
+			outputs = run( session, inputNames, inputs, outputNames, context->canceller() );
 		}
-		AsyncWaiter waiter( runOptions );
-
-		session.RunAsync(
-			runOptions, inputNames.data(),
-			// The Ort C++ API wants us to pass `Ort::Value *`, but `Ort::Value`
-			// is non-copyable and the original `Ort::Value` instances are in
-			// separate TensorDatas and can't be moved. But `Ort::Value` has the
-			// same layout as `OrtValue *` (the underlying C type) so we can
-			// just reinterpret cast from the latter. Indeed, `Run()` is going
-			// to cast straight back to `OrtValue *` to call the C API!
-			reinterpret_cast<Ort::Value *>( inputs.data() ),
-			inputs.size(),
-			outputNames.data(),
-			outputs.data(),
-			outputNames.size(),
-			waiter.callback,
-			&waiter
-		);
-
-		waiter.wait( context->canceller() );
 
 		CompoundObjectPtr result = new CompoundObject;
 		for( size_t i = 0; i < outputs.size(); ++i )
@@ -45,6 +45,7 @@
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TraceMonitor.h"
 #include "Gaffer/VTuneMonitor.h"
 
 #include "IECorePython/RefCountedBinding.h"
@@ -199,6 +200,19 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+TraceMonitor::Ptr traceMonitorConstructor( const std::string &fileName, boost::python::object pythonProcessMask, size_t bufferSize )
+{
+	std::vector<IECore::InternedString> processMask;
+	container_utils::extend_container( processMask, pythonProcessMask );
+	return new TraceMonitor( fileName, processMask, bufferSize );
+}
+
+void traceMonitorFlushWrapper( TraceMonitor &monitor )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.flush();
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -332,6 +346,24 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<TraceMonitor, Monitor>( "TraceMonitor" )
+			.def(
+				"__init__",
+				make_constructor(
+					traceMonitorConstructor, default_call_policies(),
+					(
+						arg( "fileName" ),
+						arg( "processMask" ) = boost::python::make_tuple( "computeNode:hash", "computeNode:compute" ),
+						arg( "bufferSize" ) = 65536
+					)
+				)
+			)
+			.def( "fileName", &TraceMonitor::fileName, return_value_policy<copy_const_reference>() )
+			.def( "flush", &traceMonitorFlushWrapper )
+		;
+	}
+
 #ifdef GAFFER_VTUNE
 	{
 		scope s = IECorePython::RefCountedClass<VTuneMonitor, Monitor>( "VTuneMonitor" )
@@ -133,6 +133,17 @@ void GafferModule::bindNode()
 	DependencyNodeClass<DependencyNode, DependencyNodeWrapper>();
 
 	using ComputeNodeWrapper = ComputeNodeWrapper<ComputeNode>;
-	DependencyNodeClass<ComputeNode, ComputeNodeWrapper>();
+	{
+		scope s = DependencyNodeClass<ComputeNode, ComputeNodeWrapper>()
+			.def( "setDirectEvaluation", &ComputeNode::setDirectEvaluation )
+			.def( "getDirectEvaluation", &ComputeNode::getDirectEvaluation )
+		;
+
+		enum_<ComputeNode::DirectEvaluation>( "DirectEvaluation" )
+			.value( "Automatic", ComputeNode::DirectEvaluation::Automatic )
+			.value( "Never", ComputeNode::DirectEvaluation::Never )
+			.value( "Always", ComputeNode::DirectEvaluation::Always )
+		;
+	}
 
 }
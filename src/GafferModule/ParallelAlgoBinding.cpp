@@ -83,7 +83,7 @@ std::shared_ptr<boost::python::object> withGILAcquireDeleter( const boost::pytho
 	);
 }
 
-std::shared_ptr<BackgroundTask> backgroundTaskConstructor( const Plug *subject, object f )
+std::shared_ptr<BackgroundTask> backgroundTaskConstructor( const Plug *subject, object f, BackgroundTask::Priority priority )
 {
 	auto fPtr = withGILAcquireDeleter( f );
 	auto backgroundTask = std::make_unique<BackgroundTask>(
@@ -98,7 +98,8 @@ std::shared_ptr<BackgroundTask> backgroundTaskConstructor( const Plug *subject,
 			{
 				IECorePython::ExceptionAlgo::translatePythonException();
 			}
-		}
+		},
+		priority
 	);
 
 	return withGILReleaseDeleter( backgroundTask );
@@ -222,7 +223,7 @@ void popUIThreadCallHandler()
 	ParallelAlgo::popUIThreadCallHandler();
 }
 
-std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boost::python::object f )
+std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boost::python::object f, BackgroundTask::Priority priority )
 {
 	// The BackgroundTask we return will own the python function we
 	// pass to it. Wrap the function so that the GIL is acquired
@@ -241,7 +242,8 @@ std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boo
 			{
 				IECorePython::ExceptionAlgo::translatePythonException();
 			}
-		}
+		},
+		priority
 	);
 
 	return withGILReleaseDeleter( backgroundTask );
@@ -254,12 +256,13 @@ void GafferModule::bindParallelAlgo()
 
 	{
 		scope s = class_<BackgroundTask, boost::noncopyable>( "BackgroundTask", no_init )
-			.def( "__init__", make_constructor( &backgroundTaskConstructor, default_call_policies() ) )
+			.def( "__init__", make_constructor( &backgroundTaskConstructor, default_call_policies(), ( arg( "subject" ), arg( "function" ), arg( "priority" ) = BackgroundTask::Priority::Normal ) ) )
 			.def( "cancel", &backgroundTaskCancel )
 			.def( "wait", &backgroundTaskWait )
 			.def( "waitFor", &backgroundTaskWaitFor )
 			.def( "cancelAndWait", &backgroundTaskCancelAndWait )
 			.def( "status", &backgroundTaskStatus )
+			.def( "priority", &BackgroundTask::priority )
 		;
 
 		enum_<BackgroundTask::Status>( "Status" )
@@ -269,6 +272,12 @@ void GafferModule::bindParallelAlgo()
 			.value( "Cancelled", BackgroundTask::Cancelled )
 			.value( "Errored", BackgroundTask::Errored )
 		;
+
+		enum_<BackgroundTask::Priority>( "Priority" )
+			.value( "Low", BackgroundTask::Priority::Low )
+			.value( "Normal", BackgroundTask::Priority::Normal )
+			.value( "High", BackgroundTask::Priority::High )
+		;
 	}
 
 	register_ptr_to_python<std::shared_ptr<BackgroundTask>>();
@@ -281,6 +290,6 @@ void GafferModule::bindParallelAlgo()
 	def( "pushUIThreadCallHandler", &pushUIThreadCallHandler );
 	def( "popUIThreadCallHandler", &popUIThreadCallHandler );
 	def( "canCallOnUIThread", &ParallelAlgo::canCallOnUIThread );
-	def( "callOnBackgroundThread", &callOnBackgroundThread );
+	def( "callOnBackgroundThread", &callOnBackgroundThread, ( arg( "subject" ), arg( "f" ), arg( "priority" ) = BackgroundTask::Priority::Normal ) );
 
 }
@@ -49,6 +49,8 @@
 #include "Gaffer/Reference.h"
 #include "Gaffer/Metadata.h"
 
+#include "fmt/format.h"
+
 using namespace boost::python;
 using namespace GafferBindings;
 using namespace Gaffer;
@@ -103,6 +105,35 @@ void hash2( ValuePlug *plug, IECore::MurmurHash &h )
 	plug->hash( h);
 }
 
+std::string cacheStatisticsRepr( const ValuePlug::CacheStatistics &s )
+{
+	return fmt::format(
+		"Gaffer.ValuePlug.CacheStatistics( hits = {}, misses = {}, collaborations = {}, evictions = {} )",
+		s.hits, s.misses, s.collaborations, s.evictions
+	);
+}
+
+std::string cacheUsageRepr( const ValuePlug::CacheUsage &u )
+{
+	return fmt::format( "Gaffer.ValuePlug.CacheUsage( entries = {}, bytes = {} )", u.entries, u.bytes );
+}
+
+dict cacheMemoryUsageByNodeType()
+{
+	ValuePlug::CacheUsageMap usage;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		usage = ValuePlug::cacheMemoryUsageByNodeType();
+	}
+
+	dict result;
+	for( const auto &[key, value] : usage )
+	{
+		result[make_tuple( key.first.string(), key.second.string() )] = value;
+	}
+	return result;
+}
+
 
 } // namespace
 
@@ -133,6 +164,28 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "cacheMemoryUsage" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
+		.def( "getCacheEvictionMode", &ValuePlug::getCacheEvictionMode )
+		.staticmethod( "getCacheEvictionMode" )
+		.def( "setCacheEvictionMode", &ValuePlug::setCacheEvictionMode )
+		.staticmethod( "setCacheEvictionMode" )
+		.def( "setAutomaticDirectEvaluationEnabled", &ValuePlug::setAutomaticDirectEvaluationEnabled )
+		.staticmethod( "setAutomaticDirectEvaluationEnabled" )
+		.def( "getAutomaticDirectEvaluationEnabled", &ValuePlug::getAutomaticDirectEvaluationEnabled )
+		.staticmethod( "getAutomaticDirectEvaluationEnabled" )
+		.def( "isDirectlyEvaluated", &ValuePlug::isDirectlyEvaluated )
+		.staticmethod( "isDirectlyEvaluated" )
+		.def( "getPersistentCacheDirectory", &ValuePlug::getPersistentCacheDirectory )
+		.staticmethod( "getPersistentCacheDirectory" )
+		.def( "setPersistentCacheDirectory", &ValuePlug::setPersistentCacheDirectory )
+		.staticmethod( "setPersistentCacheDirectory" )
+		.def( "getPersistentCacheSizeLimit", &ValuePlug::getPersistentCacheSizeLimit )
+		.staticmethod( "getPersistentCacheSizeLimit" )
+		.def( "setPersistentCacheSizeLimit", &ValuePlug::setPersistentCacheSizeLimit )
+		.staticmethod( "setPersistentCacheSizeLimit" )
+		.def( "persistentCacheUsage", &ValuePlug::persistentCacheUsage )
+		.staticmethod( "persistentCacheUsage" )
+		.def( "clearPersistentCache", &ValuePlug::clearPersistentCache )
+		.staticmethod( "clearPersistentCache" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
 		.staticmethod( "getHashCacheSizeLimit" )
 		.def( "setHashCacheSizeLimit", &ValuePlug::setHashCacheSizeLimit )
@@ -145,6 +198,22 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "getHashCacheMode" )
 		.def( "setHashCacheMode", &ValuePlug::setHashCacheMode )
 		.staticmethod( "setHashCacheMode" )
+		.def( "getHashCacheScope", &ValuePlug::getHashCacheScope )
+		.staticmethod( "getHashCacheScope" )
+		.def( "setHashCacheScope", &ValuePlug::setHashCacheScope )
+		.staticmethod( "setHashCacheScope" )
+		.def( "computeCacheStatistics", &ValuePlug::computeCacheStatistics )
+		.staticmethod( "computeCacheStatistics" )
+		.def( "hashCacheStatistics", &ValuePlug::hashCacheStatistics )
+		.staticmethod( "hashCacheStatistics" )
+		.def( "resetCacheStatistics", &ValuePlug::resetCacheStatistics )
+		.staticmethod( "resetCacheStatistics" )
+		.def( "setCacheUsageTrackingEnabled", &ValuePlug::setCacheUsageTrackingEnabled )
+		.staticmethod( "setCacheUsageTrackingEnabled" )
+		.def( "getCacheUsageTrackingEnabled", &ValuePlug::getCacheUsageTrackingEnabled )
+		.staticmethod( "getCacheUsageTrackingEnabled" )
+		.def( "cacheMemoryUsageByNodeType", &cacheMemoryUsageByNodeType )
+		.staticmethod( "cacheMemoryUsageByNodeType" )
 		.def( "dirtyCount", &ValuePlug::dirtyCount )
 		.def( "__repr__", &repr )
 	;
@@ -155,10 +224,35 @@ void GafferModule::bindValuePlug()
 		.value( "Legacy", ValuePlug::HashCacheMode::Legacy )
 	;
 
+	enum_<ValuePlug::HashCacheScope>( "HashCacheScope" )
+		.value( "PerThread", ValuePlug::HashCacheScope::PerThread )
+		.value( "Shared", ValuePlug::HashCacheScope::Shared )
+	;
+
+	enum_<ValuePlug::CacheEvictionMode>( "CacheEvictionMode" )
+		.value( "LeastRecentlyUsed", ValuePlug::CacheEvictionMode::LeastRecentlyUsed )
+		.value( "CostWeighted", ValuePlug::CacheEvictionMode::CostWeighted )
+	;
+
+	class_<ValuePlug::CacheStatistics>( "CacheStatistics" )
+		.def_readonly( "hits", &ValuePlug::CacheStatistics::hits )
+		.def_readonly( "misses", &ValuePlug::CacheStatistics::misses )
+		.def_readonly( "collaborations", &ValuePlug::CacheStatistics::collaborations )
+		.def_readonly( "evictions", &ValuePlug::CacheStatistics::evictions )
+		.def( "__repr__", &cacheStatisticsRepr )
+	;
+
+	class_<ValuePlug::CacheUsage>( "CacheUsage" )
+		.def_readonly( "entries", &ValuePlug::CacheUsage::entries )
+		.def_readonly( "bytes", &ValuePlug::CacheUsage::bytes )
+		.def( "__repr__", &cacheUsageRepr )
+	;
+
 	enum_<ValuePlug::CachePolicy>( "CachePolicy" )
 		.value( "Uncached", ValuePlug::CachePolicy::Uncached )
 		.value( "TaskCollaboration", ValuePlug::CachePolicy::TaskCollaboration )
 		.value( "Default", ValuePlug::CachePolicy::Default )
+		.value( "Persistent", ValuePlug::CachePolicy::Persistent )
 	;
 
 	Serialisation::registerSerialiser( Gaffer::ValuePlug::staticTypeId(), new ValuePlugSerialiser );
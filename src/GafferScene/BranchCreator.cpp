@@ -46,6 +46,8 @@
 
 #include "IECore/NullObject.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
 #include "tbb/spin_mutex.h"
 
 #include "fmt/format.h"
@@ -364,6 +366,20 @@ class BranchCreator::BranchesData : public IECore::Data
 			);
 		}
 
+		/// Returns the destinations in the same order they are visited by
+		/// `visitDestinations()`, for use in parallel algorithms.
+		using Destinations = std::vector<std::pair<ScenePlug::ScenePath, const Location::SourcePaths *>>;
+		Destinations destinations() const
+		{
+			Destinations result;
+			visitDestinations(
+				[&result] ( const ScenePlug::ScenePath &path, const Location::SourcePaths &sourcePaths ) {
+					result.emplace_back( path, &sourcePaths );
+				}
+			);
+			return result;
+		}
+
 	private :
 
 		template<typename F>
@@ -1067,20 +1083,50 @@ void BranchCreator::hashSet( const IECore::InternedString &setName, const Gaffer
 	FilteredSceneProcessor::hashSet( setName, context, parent, h );
 	inPlug()->setPlug()->hash( h );
 
-	/// \todo Parallelise.
-	branches->visitDestinations(
-		[&setName, &context, &h, this] ( const ScenePath &destination, const BranchesData::Location::SourcePaths &sourcePaths ) {
-			for( const auto &sourcePath : sourcePaths )
+	const BranchesData::Destinations destinations = branches->destinations();
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	const IECore::MurmurHash destinationsHash = tbb::parallel_deterministic_reduce(
+
+		tbb::blocked_range<size_t>( 0, destinations.size() ),
+
+		IECore::MurmurHash(),
+
+		[&] ( const tbb::blocked_range<size_t> &range, const MurmurHash &x ) {
+
+			ThreadState::Scope threadStateScope( threadState );
+
+			MurmurHash result = x;
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				MurmurHash branchSetHash;
-				hashBranchSet( sourcePath, setName, context, branchSetHash );
-				h.append( branchSetHash );
+				const ScenePath &destination = destinations[i].first;
+				for( const auto &sourcePath : *destinations[i].second )
+				{
+					MurmurHash branchSetHash;
+					hashBranchSet( sourcePath, setName, Context::current(), branchSetHash );
+					result.append( branchSetHash );
+				}
+				ScenePlug::PathScope pathScope( threadState, &destination );
+				mappingPlug()->hash( result );
+				result.append( destination.data(), destination.size() );
 			}
-			ScenePlug::PathScope pathScope( context, &destination );
-			mappingPlug()->hash( h );
-			h.append( destination.data(), destination.size() );
-		}
+			return result;
+
+		},
+
+		[] ( const MurmurHash &x, const MurmurHash &y ) {
+
+			MurmurHash result = x;
+			result.append( y );
+			return result;
+		},
+
+		taskGroupContext
+
 	);
+
+	h.append( destinationsHash );
 }
 
 IECore::ConstPathMatcherDataPtr BranchCreator::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
@@ -1093,23 +1139,58 @@ IECore::ConstPathMatcherDataPtr BranchCreator::computeSet( const IECore::Interne
 		return inputSetData;
 	}
 
-	PathMatcherDataPtr outputSetData = inputSetData->copy();
-	PathMatcher &outputSet = outputSetData->writable();
+	// Compute the contribution from each destination in parallel. The branch
+	// sets are typically cached individually, and `ChildNamesMap::set()` and
+	// `PathMatcher::addPaths()` reference their subtrees rather than copying
+	// them. So when a single branch changes, the cost of rebuilding the output
+	// is dominated by that branch rather than by the size of the set.
+
+	const BranchesData::Destinations destinations = branches->destinations();
+	vector<PathMatcher> destinationSets( destinations.size() );
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, destinations.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
 
-	/// \todo Parallelise.
-	branches->visitDestinations(
-		[&setName, &context, &outputSet, this] ( const ScenePath &destination, const BranchesData::Location::SourcePaths &sourcePaths ) {
-			vector<ConstPathMatcherDataPtr> branchSets = { nullptr };
-			for( const auto &sourcePath : sourcePaths )
+			ThreadState::Scope threadStateScope( threadState );
+
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				branchSets.push_back( computeBranchSet( sourcePath, setName, context ) );
+				vector<ConstPathMatcherDataPtr> branchSets = { nullptr };
+				bool empty = true;
+				for( const auto &sourcePath : *destinations[i].second )
+				{
+					branchSets.push_back( computeBranchSet( sourcePath, setName, Context::current() ) );
+					empty = empty && ( !branchSets.back() || branchSets.back()->readable().isEmpty() );
+				}
+				if( empty )
+				{
+					continue;
+				}
+				ScenePlug::PathScope pathScope( threadState, &destinations[i].first );
+				Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
+				destinationSets[i] = mapping->set( branchSets );
 			}
-			ScenePlug::PathScope pathScope( context, &destination );
-			Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
-			outputSet.addPaths( mapping->set( branchSets ), destination );
-		}
+		},
+		taskGroupContext
 	);
 
+	// Merge serially, starting from a shallow copy of the input set so that
+	// unmodified parts of the hierarchy are shared with it.
+
+	PathMatcherDataPtr outputSetData = inputSetData->copy();
+	PathMatcher &outputSet = outputSetData->writable();
+	for( size_t i = 0; i < destinations.size(); ++i )
+	{
+		if( !destinationSets[i].isEmpty() )
+		{
+			outputSet.addPaths( destinationSets[i], destinations[i].first );
+		}
+	}
+
 	return outputSetData;
 }
 
@@ -1117,10 +1198,10 @@ Gaffer::ValuePlug::CachePolicy BranchCreator::hashCachePolicy( const Gaffer::Val
 {
 	if( output == outPlug()->setPlug() )
 	{
-		// Technically we do not _need_ TaskCollaboration because we have not yet
-		// multithreaded `hashSet()`. But we still benefit from requesting it
-		// because it means the hash is stored in the global cache, where it is
-		// shared between all threads and is almost guaranteed not to be evicted.
+		// `hashSet()` uses TBB tasks, so we need TaskCollaboration to avoid
+		// deadlock. It also means the hash is stored in the global cache, where
+		// it is shared between all threads and is almost guaranteed not to be
+		// evicted.
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
 	else if( output == branchesPlug() )
@@ -1132,7 +1213,7 @@ Gaffer::ValuePlug::CachePolicy BranchCreator::hashCachePolicy( const Gaffer::Val
 
 Gaffer::ValuePlug::CachePolicy BranchCreator::computeCachePolicy( const Gaffer::ValuePlug *output ) const
 {
-	if( output == branchesPlug() )
+	if( output == branchesPlug() || output == outPlug()->setPlug() )
 	{
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
@@ -37,13 +37,175 @@
 #include "GafferScene/Filter.h"
 
 #include "GafferScene/FilterPlug.h"
+#include "GafferScene/SceneAlgo.h"
 #include "GafferScene/ScenePlug.h"
 
 #include "Gaffer/Context.h"
 
+#include "IECore/NullObject.h"
+#include "IECore/PathMatcherData.h"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <atomic>
+
 using namespace GafferScene;
 using namespace Gaffer;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+bool globalValue( const BoolPlug *plug, const Gaffer::Context *context )
+{
+	const BoolPlug *sourcePlug = plug->source<BoolPlug>();
+	if( !sourcePlug || sourcePlug->direction() == Plug::Out )
+	{
+		// Value may be computed. We use a global scope for two reasons :
+		//
+		// - Because our implementation assumes the result is constant across
+		//   the scene, and allowing it to vary by `scene:path` could produce
+		//   results where AncestorMatch and DescendantMatch are not consistent across locations.
+		// - To reduce pressure on the hash cache.
+		//
+		// > Note : `sourcePlug` will be null if the source is not a BoolPlug.
+		// > In this case we call `getValue()` on `plug` and it will perform the
+		// > appropriate type conversion.
+		ScenePlug::GlobalScope globalScope( context );
+		return sourcePlug ? sourcePlug->getValue() : plug->getValue();
+	}
+	else
+	{
+		// Value is not computed so context is irrelevant.
+		// Avoid overhead of context creation.
+		return sourcePlug->getValue();
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Filter::MatchesData
+//////////////////////////////////////////////////////////////////////////
+
+// Stores the result of a filter for every location in a scene. We store
+// ExactMatch and DescendantMatch results in separate PathMatchers, and
+// derive AncestorMatch from the exact matches. Locations which were not
+// visited during traversal (because the filter did not yield DescendantMatch
+// for their parent) can therefore only ever have AncestorMatch.
+class Filter::MatchesData : public IECore::Data
+{
+
+	public :
+
+		MatchesData( const Filter *filter, const ScenePlug *scene )
+			:	m_exact( new IECore::PathMatcherData ), m_descendant( new IECore::PathMatcherData )
+		{
+			struct Results
+			{
+				IECore::PathMatcher exact;
+				IECore::PathMatcher descendant;
+			};
+
+			tbb::enumerable_thread_specific<Results> threadResults;
+			auto f = [filter, &threadResults] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
+				const unsigned match = directMatch( filter, scene );
+				Results &results = threadResults.local();
+				if( match & IECore::PathMatcher::ExactMatch )
+				{
+					results.exact.addPath( path );
+				}
+				if( match & IECore::PathMatcher::DescendantMatch )
+				{
+					results.descendant.addPath( path );
+					return true;
+				}
+				return false;
+			};
+
+			ScenePlug::GlobalScope traversalScope( Context::current() );
+			SceneAlgo::parallelTraverse( scene, f );
+
+			threadResults.combine_each(
+				[this] ( const Results &results ) {
+					m_exact->writable().addPaths( results.exact );
+					m_descendant->writable().addPaths( results.descendant );
+				}
+			);
+		}
+
+		// Named so as not to hide `Object::hash()`.
+		static void hashMatches( const Filter *filter, const ScenePlug *scene, IECore::MurmurHash &h )
+		{
+			// We can't know which locations the constructor will visit without
+			// evaluating the filter, which would make the hash as expensive as
+			// the compute. Instead we visit every location, combining the hash
+			// of its child names with the hash of the filter's match. Hashes are
+			// combined using the order-independent strategy documented in
+			// `SceneAlgo::matchingPathsHash()`.
+			std::atomic<uint64_t> h1( 0 ), h2( 0 );
+			auto f = [filter, &h1, &h2] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
+				IECore::MurmurHash h;
+				h.append( path.data(), path.size() );
+				h.append( (uint64_t)path.size() );
+				scene->childNamesPlug()->hash( h );
+				directMatchHash( filter, scene, h );
+				h1 += h.h1();
+				h2 += h.h2();
+				return true;
+			};
+
+			ScenePlug::GlobalScope traversalScope( Context::current() );
+			SceneAlgo::parallelTraverse( scene, f );
+			h.append( IECore::MurmurHash( h1, h2 ) );
+		}
+
+		unsigned match( const ScenePlug::ScenePath &path ) const
+		{
+			unsigned result = m_exact->readable().match( path ) & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch );
+			if( m_descendant->readable().match( path ) & IECore::PathMatcher::ExactMatch )
+			{
+				result |= IECore::PathMatcher::DescendantMatch;
+			}
+			return result;
+		}
+
+		void memoryUsage( IECore::Object::MemoryAccumulator &accumulator ) const override
+		{
+			IECore::Data::memoryUsage( accumulator );
+			accumulator.accumulate( sizeof( MatchesData ) );
+			accumulator.accumulate( m_exact.get() );
+			accumulator.accumulate( m_descendant.get() );
+		}
+
+	private :
+
+		// Evaluate the filter directly, bypassing `outPlug()` and therefore
+		// any use of MatchesData. Must be called with `scene:path` in the context.
+		static unsigned directMatch( const Filter *filter, const ScenePlug *scene )
+		{
+			FilterPlug::SceneScope sceneScope( Context::current(), scene );
+			return filter->computeMatch( scene, Context::current() );
+		}
+
+		static void directMatchHash( const Filter *filter, const ScenePlug *scene, IECore::MurmurHash &h )
+		{
+			FilterPlug::SceneScope sceneScope( Context::current(), scene );
+			filter->hashMatch( scene, Context::current(), h );
+		}
+
+		IECore::PathMatcherDataPtr m_exact;
+		IECore::PathMatcherDataPtr m_descendant;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Filter
+//////////////////////////////////////////////////////////////////////////
+
 GAFFER_NODE_DEFINE_TYPE( Filter );
 
 const IECore::InternedString Filter::inputSceneContextName( "scene:filter:inputScene" );
@@ -67,6 +229,11 @@ Filter::Filter( const std::string &name )
 	// independent of context though, so we use the `AcceptsDependencyCycles` flag to
 	// show that any cycle is expected and harmless.
 	addChild( new FilterPlug( "out", Gaffer::Plug::Out, Plug::Default | Plug::AcceptsDependencyCycles ) );
+	addChild( new BoolPlug( "cacheMatches", Gaffer::Plug::In, false ) );
+	// `__matches` depends on `out` (via `computeMatch()`), and `out` depends
+	// on `__matches` when `cacheMatches` is on. Again, this isn't a true cycle
+	// because `out` only uses one or the other.
+	addChild( new ObjectPlug( "__matches", Gaffer::Plug::Out, IECore::NullObject::defaultNullObject(), Plug::Default | Plug::AcceptsDependencyCycles ) );
 }
 
 Filter::~Filter()
@@ -93,14 +260,51 @@ const FilterPlug *Filter::outPlug() const
 	return getChild<FilterPlug>( g_firstPlugIndex + 1 );
 }
 
+Gaffer::BoolPlug *Filter::cacheMatchesPlug()
+{
+	return getChild<Gaffer::BoolPlug>( g_firstPlugIndex + 2 );
+}
+
+const Gaffer::BoolPlug *Filter::cacheMatchesPlug() const
+{
+	return getChild<Gaffer::BoolPlug>( g_firstPlugIndex + 2 );
+}
+
+Gaffer::ObjectPlug *Filter::matchesPlug()
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::ObjectPlug *Filter::matchesPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 3 );
+}
+
 void Filter::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ComputeNode::affects( input, outputs );
 
-	if( input == enabledPlug() )
+	if(
+		input == enabledPlug() ||
+		input == cacheMatchesPlug() ||
+		input == matchesPlug()
+	)
 	{
 		outputs.push_back( outPlug() );
 	}
+	else if( input == outPlug() )
+	{
+		outputs.push_back( matchesPlug() );
+	}
+	else if( auto scene = input->parent<ScenePlug>() )
+	{
+		if( input == scene->childNamesPlug() )
+		{
+			// Called via `FilterPlug::sceneAffects()`. The hierarchy
+			// determines which locations `matchesPlug()` visits.
+			outputs.push_back( matchesPlug() );
+		}
+	}
 }
 
 void Filter::setInputScene( Gaffer::Context *context, const ScenePlug *scenePlug )
@@ -128,9 +332,28 @@ void Filter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *conte
 			/// avoid the redundant call to ComputeNode::hash() in the case
 			/// that their hashMatch() implementation simply passes through an
 			/// input hash.
-			hashMatch( getInputScene( context ), context, h );
+			const ScenePlug *scene = getInputScene( context );
+			if( scene && cacheMatches( context ) )
+			{
+				matchesHash( context, h );
+				// Path is absent when Prune and Isolate request a hash
+				// representing the filter across the whole scene.
+				if( auto path = context->getIfExists<ScenePlug::ScenePath>( ScenePlug::scenePathContextName ) )
+				{
+					h.append( path->data(), path->size() );
+					h.append( (uint64_t)path->size() );
+				}
+			}
+			else
+			{
+				hashMatch( scene, context, h );
+			}
 		}
 	}
+	else if( output == matchesPlug() )
+	{
+		MatchesData::hashMatches( this, getInputScene( context ), h );
+	}
 }
 
 void Filter::compute( ValuePlug *output, const Context *context ) const
@@ -140,11 +363,24 @@ void Filter::compute( ValuePlug *output, const Context *context ) const
 		unsigned match = IECore::PathMatcher::NoMatch;
 		if( enabled( context ) )
 		{
-			match = computeMatch( getInputScene( context ), context );
+			const ScenePlug *scene = getInputScene( context );
+			if( scene && cacheMatches( context ) )
+			{
+				match = matches( context )->match( context->get<ScenePlug::ScenePath>( ScenePlug::scenePathContextName ) );
+			}
+			else
+			{
+				match = computeMatch( scene, context );
+			}
 		}
 		static_cast<FilterPlug *>( output )->setValue( match );
 		return;
 	}
+	else if( output == matchesPlug() )
+	{
+		static_cast<ObjectPlug *>( output )->setValue( new MatchesData( this, getInputScene( context ) ) );
+		return;
+	}
 
 	ComputeNode::compute( output, context );
 }
@@ -155,9 +391,22 @@ Gaffer::ValuePlug::CachePolicy Filter::computeCachePolicy( const Gaffer::ValuePl
 	{
 		return ValuePlug::CachePolicy::Uncached;
 	}
+	else if( output == matchesPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
 	return ComputeNode::computeCachePolicy( output );
 }
 
+Gaffer::ValuePlug::CachePolicy Filter::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == matchesPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return ComputeNode::hashCachePolicy( output );
+}
+
 void Filter::hashMatch( const ScenePlug *scene, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	/// \todo See comments in hash() method.
@@ -170,27 +419,26 @@ unsigned Filter::computeMatch( const ScenePlug *scene, const Gaffer::Context *co
 
 bool Filter::enabled( const Gaffer::Context *context ) const
 {
-	const BoolPlug *plug = enabledPlug();
-	const BoolPlug *sourcePlug = plug->source<BoolPlug>();
-	if( !sourcePlug || sourcePlug->direction() == Plug::Out )
-	{
-		// Value may be computed. We use a global scope for two reasons :
-		//
-		// - Because our implementation assumes the result is constant across
-		//   the scene, and allowing it to vary by `scene:path` could produce
-		//   results where AncestorMatch and DescendantMatch are not consistent across locations.
-		// - To reduce pressure on the hash cache.
-		//
-		// > Note : `sourcePlug` will be null if the source is not a BoolPlug.
-		// > In this case we call `getValue()` on `plug` and it will perform the
-		// > appropriate type conversion.
-		ScenePlug::GlobalScope globalScope( context );
-		return sourcePlug ? sourcePlug->getValue() : plug->getValue();
-	}
-	else
-	{
-		// Value is not computed so context is irrelevant.
-		// Avoid overhead of context creation.
-		return sourcePlug->getValue();
-	}
+	return globalValue( enabledPlug(), context );
+}
+
+bool Filter::cacheMatches( const Gaffer::Context *context ) const
+{
+	return globalValue( cacheMatchesPlug(), context );
+}
+
+void Filter::matchesHash( const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	const uint64_t scene = context->get<uint64_t>( inputSceneContextName );
+	ScenePlug::GlobalScope globalScope( context );
+	globalScope.set( inputSceneContextName, &scene );
+	matchesPlug()->hash( h );
+}
+
+Filter::ConstMatchesDataPtr Filter::matches( const Gaffer::Context *context ) const
+{
+	const uint64_t scene = context->get<uint64_t>( inputSceneContextName );
+	ScenePlug::GlobalScope globalScope( context );
+	globalScope.set( inputSceneContextName, &scene );
+	return boost::static_pointer_cast<const MatchesData>( matchesPlug()->getValue() );
 }
@@ -900,14 +900,19 @@ IECore::ConstPathMatcherDataPtr MergeScenes::computeSet( const IECore::InternedS
 					result = scene->setPlug()->getValue();
 					break;
 				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new PathMatcherData();
+					// Initialise merged result with a shallow copy of
+					// the first input. PathMatcher shares unmodified
+					// subtrees between copies, so the cost of merging is
+					// proportional to the other inputs only.
+					merged = scene->setPlug()->getValue()->copy();
 					result = merged;
-					[[fallthrough]];
+					break;
 				case InputType::Other :
 					ConstPathMatcherDataPtr paths = scene->setPlug()->getValue();
-					merged->writable().addPaths( paths->readable() );
+					if( !paths->readable().isEmpty() )
+					{
+						merged->writable().addPaths( paths->readable() );
+					}
 			}
 			return true;
 		}
@@ -1466,7 +1466,9 @@ std::shared_ptr<Gaffer::BackgroundTask> RenderController::updateInBackground( co
 				updateInternal( callback, &priorityPaths, /* signalCompletion = */ false );
 			}
 			updateInternal( callback );
-		}
+		},
+		// Priority. Render updates are needed for interactive feedback.
+		BackgroundTask::Priority::High
 	);
 
 	return m_backgroundTask;
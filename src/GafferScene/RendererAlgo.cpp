@@ -71,6 +71,7 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <filesystem>
 
 using namespace std;
@@ -524,8 +525,20 @@ std::optional<SampledTransform> transformSamples( const M44fPlug *transformPlug,
 		result.sampleTimes.reserve( sampleTimes.size() );
 		for( size_t i = 0; i < sampleTimes.size(); i++ )
 		{
-			timeContext.setFrame( sampleTimes[i] );
-			const M44f m = transformPlug->getValue( &sampleHashes[i] );
+			// Samples with the same hash as an earlier one (for instance, where
+			// the transform is held for part of the shutter) reuse that value
+			// rather than evaluating the plug again.
+			const size_t matchingSample = std::find( sampleHashes.begin(), sampleHashes.begin() + i, sampleHashes[i] ) - sampleHashes.begin();
+			M44f m;
+			if( matchingSample < i )
+			{
+				m = result.samples[matchingSample];
+			}
+			else
+			{
+				timeContext.setFrame( sampleTimes[i] );
+				m = transformPlug->getValue( &sampleHashes[i] );
+			}
 			if( !moving && !result.samples.empty() && m != result.samples.front() )
 			{
 				moving = true;
@@ -648,6 +661,18 @@ std::optional<SampledObject> objectSamples( const Gaffer::ObjectPlug *objectPlug
 		result.samples.reserve( sampleTimes.size() );
 		for( size_t i = 0; i < sampleTimes.size(); i++ )
 		{
+			// Share the object from any earlier sample with a matching hash, so
+			// that objects which are static for part of the shutter are only
+			// evaluated (and stored) once. Every sample we have taken so far
+			// has been appended to `result.samples`, so indices correspond.
+			const size_t matchingSample = std::find( sampleHashes.begin(), sampleHashes.begin() + i, sampleHashes[i] ) - sampleHashes.begin();
+			if( matchingSample < i )
+			{
+				result.samples.push_back( result.samples[matchingSample] );
+				result.sampleTimes.push_back( sampleTimes[i] );
+				continue;
+			}
+
 			timeContext.setFrame( sampleTimes[i] );
 
 			ConstObjectPtr object = objectPlug->getValue( &sampleHashes[i] );
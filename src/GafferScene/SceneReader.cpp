@@ -131,11 +131,15 @@ ValuePlug::CachePolicy cachePolicyFromEnv( const char *name )
 		{
 			return ValuePlug::CachePolicy::Default;
 		}
+		else if( !strcmp( cp, "Persistent" ) )
+		{
+			return ValuePlug::CachePolicy::Persistent;
+		}
 		else
 		{
 			IECore::msg(
 				IECore::Msg::Warning, "SceneReader",
-				fmt::format( "Invalid value \"{}\" for {}. Must be TaskCollaboration or Default.", cp, name )
+				fmt::format( "Invalid value \"{}\" for {}. Must be TaskCollaboration, Default or Persistent.", cp, name )
 			);
 		}
 	}
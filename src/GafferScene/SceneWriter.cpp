@@ -44,8 +44,14 @@
 
 #include "IECoreScene/SceneInterface.h"
 
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
 using namespace IECore;
@@ -56,16 +62,105 @@ using namespace GafferScene;
 namespace
 {
 
+// The hashes of the values most recently written for a location, and the
+// times they were written at. Used to avoid recomputing and rewriting values
+// that haven't changed since the previous frame. We don't store the values
+// themselves, because that would keep a whole frame of the scene in memory.
+struct LocationHistory
+{
+	IECore::MurmurHash objectHash;
+	float objectTime = 0;
+
+	IECore::MurmurHash transformHash;
+	float transformTime = 0;
+
+	IECore::MurmurHash attributesHash;
+	float attributesTime = 0;
+};
+
+using History = std::unordered_map<std::string, LocationHistory>;
+
 struct LocationData
 {
-	LocationData( const ScenePlug *scene, const ScenePlug::ScenePath &path, const CompoundData *setsForTags )
+	// `history` contains the locations visited on the previous frame, which
+	// was at `previousFrame` and `previousTime`.
+	LocationData( const ScenePlug *scene, const ScenePlug::ScenePath &path, const CompoundData *setsForTags, const History &history, float previousFrame, float previousTime, float time )
 		:	m_path( path ),
-			m_attributes( scene->attributesPlug()->getValue() ),
-			m_object( scene->objectPlug()->getValue() ),
 			m_bound( scene->boundPlug()->getValue() ),
-			m_transform( scene->transformPlug()->getValue() ),
 			m_childNames( scene->childNamesPlug()->getValue() )
 	{
+		ScenePlug::pathToString( path, m_pathString );
+		auto it = history.find( m_pathString );
+		const LocationHistory *previous = it != history.end() ? &it->second : nullptr;
+
+		// For each property, we check the hash against the previous frame, and only
+		// compute and write a new value if it has changed. Otherwise we leave the
+		// previously written sample to represent the value, relying on the
+		// SceneInterface to hold it constant. When a value changes after being
+		// held, we must first write the held value again at the previous frame,
+		// so that the change isn't interpolated across all the held frames.
+
+		bool holdObject = false;
+		m_history.objectHash = scene->objectPlug()->hash();
+		if( previous && previous->objectHash == m_history.objectHash )
+		{
+			m_history.objectTime = previous->objectTime;
+		}
+		else
+		{
+			m_object = scene->objectPlug()->getValue();
+			m_history.objectTime = time;
+			holdObject = previous && previous->objectTime < previousTime;
+		}
+
+		m_history.transformHash = scene->transformPlug()->hash();
+		if( previous && previous->transformHash == m_history.transformHash )
+		{
+			m_history.transformTime = previous->transformTime;
+		}
+		else
+		{
+			m_transform = scene->transformPlug()->getValue();
+			m_writeTransform = true;
+			m_history.transformTime = time;
+			m_holdTransform = previous && previous->transformTime < previousTime;
+		}
+
+		bool holdAttributes = false;
+		m_history.attributesHash = scene->attributesPlug()->hash();
+		if( previous && previous->attributesHash == m_history.attributesHash )
+		{
+			m_history.attributesTime = previous->attributesTime;
+		}
+		else
+		{
+			m_attributes = scene->attributesPlug()->getValue();
+			m_history.attributesTime = time;
+			holdAttributes = previous && previous->attributesTime < previousTime;
+		}
+
+		if( holdObject || m_holdTransform || holdAttributes )
+		{
+			// The held values are unchanged since they were written, so we can
+			// recompute them from the previous frame, where they are likely to
+			// still be in the cache.
+			Context::EditableScope previousScope( Context::current() );
+			previousScope.setFrame( previousFrame );
+			m_heldTime = previousTime;
+			if( holdObject )
+			{
+				m_heldObject = scene->objectPlug()->getValue();
+			}
+			if( m_holdTransform )
+			{
+				m_heldTransform = scene->transformPlug()->getValue();
+			}
+			if( holdAttributes )
+			{
+				m_heldAttributes = scene->attributesPlug()->getValue();
+			}
+		}
+
 		if( setsForTags )
 		{
 			const CompoundDataMap &setsMap = setsForTags->readable();
@@ -90,27 +185,33 @@ struct LocationData
 			scene = scene->child( p, SceneInterface::CreateIfMissing );
 		}
 
-		if( m_object->typeId() != IECore::NullObjectTypeId && m_path.size() > 0 )
+		if( m_heldObject )
+		{
+			writeObject( scene.get(), m_heldObject.get(), m_heldTime );
+		}
+		if( m_object )
 		{
-			scene->writeObject( m_object.get(), time );
+			writeObject( scene.get(), m_object.get(), time );
 		}
 
 		scene->writeBound( Imath::Box3d( Imath::V3f( m_bound.min ), Imath::V3f( m_bound.max ) ), time );
 
-		if( m_path.size() )
+		if( m_holdTransform )
+		{
+			writeTransform( scene.get(), m_heldTransform, m_heldTime );
+		}
+		if( m_writeTransform )
 		{
-			M44dDataPtr td = new IECore::M44dData( Imath::M44d (
-				m_transform[0][0], m_transform[0][1], m_transform[0][2], m_transform[0][3],
-				m_transform[1][0], m_transform[1][1], m_transform[1][2], m_transform[1][3],
-				m_transform[2][0], m_transform[2][1], m_transform[2][2], m_transform[2][3],
-				m_transform[3][0], m_transform[3][1], m_transform[3][2], m_transform[3][3]
-			) );
-			scene->writeTransform( td.get(), time );
+			writeTransform( scene.get(), m_transform, time );
 		}
 
-		for( const auto &[name, value] : m_attributes->members() )
+		if( m_heldAttributes )
 		{
-			scene->writeAttribute( name, value.get(), time );
+			writeAttributes( scene.get(), m_heldAttributes.get(), m_heldTime );
+		}
+		if( m_attributes )
+		{
+			writeAttributes( scene.get(), m_attributes.get(), time );
 		}
 
 		if( !m_tags.empty() )
@@ -127,16 +228,235 @@ struct LocationData
 		}
 	}
 
+	// Approximate memory used by values that will be written.
+	size_t memoryUsage() const
+	{
+		size_t result = sizeof( LocationData );
+		for( const Object *o : { m_object.get(), m_heldObject.get() } )
+		{
+			result += o ? o->memoryUsage() : 0;
+		}
+		for( const Object *o : { m_attributes.get(), m_heldAttributes.get() } )
+		{
+			result += o ? o->memoryUsage() : 0;
+		}
+		return result;
+	}
+
+	const std::string &pathString() const
+	{
+		return m_pathString;
+	}
+
+	const LocationHistory &history() const
+	{
+		return m_history;
+	}
+
 	private :
 
+		void writeObject( SceneInterface *scene, const Object *object, float time ) const
+		{
+			if( object->typeId() != IECore::NullObjectTypeId && m_path.size() > 0 )
+			{
+				scene->writeObject( object, time );
+			}
+		}
+
+		void writeTransform( SceneInterface *scene, const Imath::M44f &transform, float time ) const
+		{
+			if( m_path.size() )
+			{
+				M44dDataPtr td = new IECore::M44dData( Imath::M44d (
+					transform[0][0], transform[0][1], transform[0][2], transform[0][3],
+					transform[1][0], transform[1][1], transform[1][2], transform[1][3],
+					transform[2][0], transform[2][1], transform[2][2], transform[2][3],
+					transform[3][0], transform[3][1], transform[3][2], transform[3][3]
+				) );
+				scene->writeTransform( td.get(), time );
+			}
+		}
+
+		void writeAttributes( SceneInterface *scene, const CompoundObject *attributes, float time ) const
+		{
+			for( const auto &[name, value] : attributes->members() )
+			{
+				scene->writeAttribute( name, value.get(), time );
+			}
+		}
+
 		ScenePlug::ScenePath m_path;
-		ConstCompoundObjectPtr m_attributes;
-		ConstObjectPtr m_object;
+		std::string m_pathString;
 		Imath::Box3f m_bound;
-		Imath::M44f m_transform;
 		ConstInternedStringVectorDataPtr m_childNames;
 		SceneInterface::NameList m_tags;
 
+		LocationHistory m_history;
+		ConstObjectPtr m_object;
+		Imath::M44f m_transform;
+		bool m_writeTransform = false;
+		ConstCompoundObjectPtr m_attributes;
+
+		float m_heldTime = 0;
+		ConstObjectPtr m_heldObject;
+		Imath::M44f m_heldTransform;
+		bool m_holdTransform = false;
+		ConstCompoundObjectPtr m_heldAttributes;
+
+};
+
+// Everything needed to write a single frame.
+struct FrameData
+{
+	SceneInterfacePtr output;
+	float time;
+	std::vector<LocationData> locations;
+	ConstCompoundDataPtr sets;
+	ConstCompoundObjectPtr globals;
+
+	void write() const
+	{
+		for( const auto &location : locations )
+		{
+			location.write( output.get(), time );
+		}
+
+		if( sets )
+		{
+			for( const auto &[name, data] : sets->readable() )
+			{
+				output->writeSet( name, static_cast<const PathMatcherData *>( data.get() )->readable() );
+			}
+		}
+
+		if( !globals->members().empty() )
+		{
+			output->writeAttribute( "gaffer:globals", globals.get(), time );
+		}
+	}
+};
+
+// The maximum amount of frame data held in a FrameWriter before `push()` blocks.
+const size_t g_frameWriterMemoryLimit = 1024 * 1024 * 1024;
+
+// Writes frames on a dedicated thread, so that the next frame can be computed
+// while the previous one is written. Frames are written in the order they are
+// pushed, and the queue is bounded so that memory usage is limited when
+// computation outpaces writing. Errors from failed writes are rethrown by the
+// next call to `push()` or `flush()`.
+class FrameWriter
+{
+
+	public :
+
+		FrameWriter()
+			:	m_queuedBytes( 0 ), m_writing( false ), m_abort( false ), m_thread( [this] { run(); } )
+		{
+		}
+
+		~FrameWriter()
+		{
+			// If we get here without `flush()` having been called, it is because
+			// an exception is propagating, so we abandon any pending writes.
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_abort = true;
+			}
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+		void push( std::unique_ptr<FrameData> frame, size_t bytes )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			// We always accept at least one frame, so that frames larger
+			// than the limit can't block forever.
+			m_condition.wait(
+				lock, [&] { return m_exception || ( m_queue.empty() && !m_writing ) || m_queuedBytes + bytes <= g_frameWriterMemoryLimit; }
+			);
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
+			m_queue.push_back( { std::move( frame ), bytes } );
+			m_queuedBytes += bytes;
+			lock.unlock();
+			m_condition.notify_all();
+		}
+
+		// Waits for all pending frames to be written.
+		void flush()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_condition.wait( lock, [&] { return m_exception || ( m_queue.empty() && !m_writing ); } );
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
+		}
+
+	private :
+
+		void run()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				m_condition.wait( lock, [&] { return m_abort || !m_queue.empty(); } );
+				if( m_abort )
+				{
+					return;
+				}
+
+				Frame frame = std::move( m_queue.front() );
+				m_queue.pop_front();
+				m_writing = true;
+				lock.unlock();
+
+				std::exception_ptr exception;
+				try
+				{
+					frame.data->write();
+				}
+				catch( ... )
+				{
+					exception = std::current_exception();
+				}
+				// Release the data (and possibly close the file) before
+				// we reacquire the lock.
+				frame.data.reset();
+
+				lock.lock();
+				m_writing = false;
+				m_queuedBytes -= frame.bytes;
+				if( exception && !m_exception )
+				{
+					m_exception = exception;
+					m_queue.clear();
+					m_queuedBytes = 0;
+				}
+				m_condition.notify_all();
+			}
+		}
+
+		struct Frame
+		{
+			std::unique_ptr<FrameData> data;
+			size_t bytes;
+		};
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<Frame> m_queue;
+		size_t m_queuedBytes;
+		bool m_writing;
+		bool m_abort;
+		std::exception_ptr m_exception;
+
+		// Declared last, so that the thread is started after all
+		// other members are initialised.
+		std::thread m_thread;
+
 };
 
 } // namespace
@@ -220,24 +540,57 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 		throw IECore::Exception( "No input scene" );
 	}
 
+	// We compute each frame on this thread, and hand it over to a FrameWriter
+	// to be written on another. This allows the computation of the next frame
+	// to overlap with the writing of the previous one.
+
+	FrameWriter writer;
 	SceneInterfacePtr output;
+	std::unordered_set<std::string> fileNames;
+	History history;
+	float previousFrame = 0;
+	float previousTime = 0;
 	Context::EditableScope scope( Context::current() );
 
 	for( auto frame : frames )
 	{
 		scope.setFrame( frame );
+		const float time = scope.context()->getTime();
+
+		auto frameData = std::make_unique<FrameData>();
+		frameData->time = time;
 
 		ConstCompoundDataPtr sets;
 		bool useSetsAPI = true;
 		const std::string fileName = fileNamePlug()->getValue();
 		if( !output || output->fileName() != fileName )
 		{
+			if( !fileNames.insert( fileName ).second )
+			{
+				// We're returning to a file we wrote earlier in the sequence. Wait
+				// for the previous version to be written and closed before we
+				// overwrite it.
+				output = nullptr;
+				writer.flush();
+			}
 			createDirectories( fileName );
 			output = SceneInterface::create( fileName, IndexedIO::Write );
 			sets = SceneAlgo::sets( scene );
 			useSetsAPI = SceneReader::useSetsAPI( output.get() );
+			// Everything must be written to the new file.
+			history.clear();
+		}
+		else if( time <= previousTime )
+		{
+			// Samples must be written in order, so we can only skip
+			// unchanged values when time is increasing.
+			history.clear();
 		}
 
+		frameData->output = output;
+
+		History nextHistory;
+		size_t bytes = 0;
 		SceneAlgo::parallelGatherLocations(
 
 			scene,
@@ -245,33 +598,35 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 			// Collect LocationData from each location in parallel.
 
 			[&] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
-				return LocationData( scene, path, useSetsAPI ? nullptr : sets.get() );
+				return LocationData( scene, path, useSetsAPI ? nullptr : sets.get(), history, previousFrame, previousTime, time );
 			},
 
-			// Write to output serially, because SceneInterfaces are not
-			// thread-safe for writing.
+			// Gather serially, in the order SceneInterface children must
+			// be written in.
 
-			[&] ( const LocationData &locationData ) {
-				locationData.write( output.get(), scope.context()->getTime() );
+			[&] ( LocationData &locationData ) {
+				nextHistory[locationData.pathString()] = locationData.history();
+				bytes += locationData.memoryUsage();
+				frameData->locations.push_back( std::move( locationData ) );
 			}
 
 		);
 
+		history.swap( nextHistory );
+		previousFrame = frame;
+		previousTime = time;
+
 		if( useSetsAPI && sets )
 		{
-			for( const auto &[name, data] : sets->readable() )
-			{
-				output->writeSet( name, static_cast<const PathMatcherData *>( data.get() )->readable() );
-			}
+			frameData->sets = sets;
 		}
 
-		ConstCompoundObjectPtr globals = scene->globals();
-		if( !globals->members().empty() )
-		{
-			output->writeAttribute( "gaffer:globals", globals.get(), scope.context()->getTime() );
-		}
+		frameData->globals = scene->globals();
 
+		writer.push( std::move( frameData ), bytes );
 	}
+
+	writer.flush();
 }
 
 bool SceneWriter::requiresSequenceExecution() const
@@ -403,3 +403,87 @@ void GafferTest::testContextHashValidation()
 
 	GAFFERTEST_ASSERTEQUAL( error, "Context variable \"value\" has an invalid hash" );
 }
+
+namespace
+{
+
+// Returns the hash for `context`, computed from scratch
+// rather than using any hash cached by `context`.
+IECore::MurmurHash freshHash( const Context *context )
+{
+	ContextPtr fresh = new Context();
+	fresh->remove( "frame" );
+	fresh->remove( "framesPerSecond" );
+
+	vector<InternedString> names;
+	context->names( names );
+	for( const auto &name : names )
+	{
+		fresh->set( name, context->getAsData( name ).get() );
+	}
+
+	return fresh->hash();
+}
+
+} // namespace
+
+void GafferTest::testEditableScopeReuse()
+{
+	ContextPtr context = new Context();
+	context->set( "a", 1 );
+	context->set( "b", 2 );
+	context->set( "c", string( "c" ) );
+	// Make sure the hash is valid, so that the EditableScopes
+	// below exercise the incremental hash updates.
+	context->hash();
+
+	int ten = 10;
+	string cat = "cat";
+	for( int i = 0; i < 3; ++i )
+	{
+		{
+			Context::EditableScope scope( context.get() );
+			GAFFERTEST_ASSERT( scope.context()->hash() == context->hash() );
+
+			scope.set( "a", &ten );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+			scope.set( "d", &cat );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+			scope.setAllocated( "e", 40 );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+			scope.setFrame( 5 );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+			scope.remove( "b" );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+			scope.removeMatching( "c d" );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+			scope.remove( "doesNotExist" );
+			GAFFERTEST_ASSERT( scope.context()->hash() == freshHash( scope.context() ) );
+		}
+
+		// A new scope may reuse the context from the previous one, but
+		// must not see any of the variables set there.
+
+		Context::EditableScope scope( context.get() );
+		GAFFERTEST_ASSERT( scope.context()->hash() == context->hash() );
+		GAFFERTEST_ASSERT( *scope.context() == *context );
+		GAFFERTEST_ASSERTEQUAL( scope.context()->get<int>( "a" ), 1 );
+		GAFFERTEST_ASSERTEQUAL( scope.context()->get<int>( "b" ), 2 );
+		GAFFERTEST_ASSERT( !scope.context()->getIfExists<int>( "e" ) );
+		GAFFERTEST_ASSERT( !scope.context()->getIfExists<string>( "d" ) );
+	}
+
+	// Taking a reference to the context of an EditableScope must
+	// keep it alive and unchanged, even if the scope is destroyed
+	// and another one created.
+
+	ContextPtr held;
+	{
+		Context::EditableScope scope( context.get() );
+		scope.set( "a", &ten );
+		held = const_cast<Context *>( scope.context() );
+	}
+	Context::EditableScope scope( context.get() );
+	GAFFERTEST_ASSERT( held.get() != scope.context() );
+	GAFFERTEST_ASSERTEQUAL( held->get<int>( "a" ), 10 );
+}
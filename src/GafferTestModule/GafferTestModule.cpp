@@ -108,6 +108,7 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "testContextCopyPerformance", &testContextCopyPerformance );
 	def( "testCopyEditableScope", &testCopyEditableScope );
 	def( "testContextHashValidation", &testContextHashValidation );
+	def( "testEditableScopeReuse", &testEditableScopeReuse );
 	def( "testComputeNodeThreading", &testComputeNodeThreading );
 	def( "testDownstreamIterator", &testDownstreamIterator );
 	def( "testRandomPerf", &testRandomPerf );
@@ -799,6 +799,78 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheRetention
+{
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+				cost = 1;
+				return key;
+			},
+			10
+		);
+
+		// Item with retention should survive while other
+		// items without retention are evicted.
+
+		cache.setIfUncached(
+			-1, -1,
+			[] ( int value ) { return 1; },
+			[] ( size_t cost ) { return 5; }
+		);
+
+		for( int i = 0; i < 30; ++i )
+		{
+			GAFFERTEST_ASSERTEQUAL( cache.get( i ), i );
+		}
+
+		GAFFERTEST_ASSERT( cache.cached( -1 ) );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 10 );
+
+		// But the retention is used up eventually.
+
+		for( int i = 30; i < 200; ++i )
+		{
+			GAFFERTEST_ASSERTEQUAL( cache.get( i ), i );
+		}
+
+		GAFFERTEST_ASSERT( !cache.cached( -1 ) );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 10 );
+
+		// Unless the item is used again, in which case the
+		// full retention is restored.
+
+		cache.setIfUncached(
+			-2, -2,
+			[] ( int value ) { return 1; },
+			[] ( size_t cost ) { return 5; }
+		);
+
+		for( int i = 200; i < 400; ++i )
+		{
+			GAFFERTEST_ASSERTEQUAL( cache.get( i ), i );
+			if( i % 25 == 0 )
+			{
+				GAFFERTEST_ASSERT( cache.getIfCached( -2 ) );
+			}
+		}
+
+		GAFFERTEST_ASSERT( cache.cached( -2 ) );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 10 );
+	}
+
+};
+
+void testLRUCacheRetention( const std::string &policy )
+{
+	DispatchTest<TestLRUCacheRetention>()( policy );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -814,4 +886,5 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "testLRUCacheRetention", &testLRUCacheRetention );
 }
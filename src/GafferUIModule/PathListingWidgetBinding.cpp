@@ -1262,7 +1262,10 @@ class PathModel : public QAbstractItemModel
 							[this] () { scheduleUpdate(); }
 						);
 					}
-				}
+				},
+				// Low priority, so that we don't hold up more interactive
+				// updates such as those in the Viewer.
+				BackgroundTask::Priority::Low
 			);
 			m_updateScheduled = false;
 		}
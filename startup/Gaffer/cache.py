@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import os
 import psutil
 
 import Gaffer
@@ -44,3 +45,18 @@ import Gaffer
 Gaffer.ValuePlug.setCacheMemoryLimit(
 	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
 )
+
+# Enable the persistent cache if a directory has been provided.
+
+if os.environ.get( "GAFFER_PERSISTENT_CACHE_DIRECTORY" ) :
+	Gaffer.ValuePlug.setPersistentCacheDirectory( os.environ["GAFFER_PERSISTENT_CACHE_DIRECTORY"] )
+
+# Size limit for the persistent cache, specified in megabytes.
+
+if os.environ.get( "GAFFER_PERSISTENT_CACHE_SIZE_LIMIT" ) :
+	Gaffer.ValuePlug.setPersistentCacheSizeLimit( int( os.environ["GAFFER_PERSISTENT_CACHE_SIZE_LIMIT"] ) * 1024**2 )
+
+# Enable automatic direct evaluation of cheap plugs if requested.
+
+if os.environ.get( "GAFFER_AUTOMATIC_DIRECT_EVALUATION", "0" ) != "0" :
+	Gaffer.ValuePlug.setAutomaticDirectEvaluationEnabled( True )